@@ -67,7 +67,72 @@
     #define LCD_D6_LAT LATAbits.LATA4  //LAT bit of the pin connected to "D6"
     #define LCD_D7_LAT LATAbits.LATA5  //LAT bit of the pin connected to "D7"
 
+    #define LCD_USE_RW 0                  //1 if "R/W" is connected to a pin(enables reading), 0 if it's tied to ground
+    #define LCD_RW_TRIS TRISAbits.TRISA6  //TRIS bit of the pin connected to "R/W"(only used if LCD_USE_RW is 1)
+    #define LCD_RW_LAT  LATAbits.LATA6    //LAT bit of the pin connected to "R/W"(only used if LCD_USE_RW is 1)
+    #define LCD_D4_PORT PORTAbits.RA2     //PORT bit of the pin connected to "D4"(only used if LCD_USE_RW is 1)
+    #define LCD_D5_PORT PORTAbits.RA3     //PORT bit of the pin connected to "D5"(only used if LCD_USE_RW is 1)
+    #define LCD_D6_PORT PORTAbits.RA4     //PORT bit of the pin connected to "D6"(only used if LCD_USE_RW is 1)
+    #define LCD_D7_PORT PORTAbits.RA5     //PORT bit of the pin connected to "D7"(only used if LCD_USE_RW is 1)
+
     #define _XTAL_FREQ 64000000  //Frequency of the sytem clock
+
+    #define LCD_USE_TIMER          0     //1 if a free-running 16-bit timer is available(see below), 0 to use delays
+    #define LCD_TIMER              TMR1  //16-bit register of the free-running timer(only used if LCD_USE_TIMER is 1)
+    #define LCD_TIMER_TICKS_PER_US 1     //Timer ticks per microsecond(1-8, only used if LCD_USE_TIMER is 1)
+
+    #define LCD_CALIBRATE        0   //1 to measure the delays of the LCD at init(needs LCD_USE_RW and LCD_USE_TIMER)
+    #define LCD_CALIBRATE_MARGIN 25  //Safety margin added to the measured delays[%]
+
+    #define LCD_USE_FLOAT 0  //1 to include "LCD_write_float"(and the float library), 0 to leave it out
+
+    #define LCD_USE_HEX           0  //1 to include "LCD_write_hex" and "LCD_write_bin", 0 to leave them out
+    #define LCD_USE_TEXT          0  //1 to include "LCD_write_text", 0 to leave it out
+    #define LCD_USE_EXEC          0  //1 to include "LCD_exec"(needed by the screens of "LCD.hpp"), 0 to leave it out
+    #define LCD_USE_SET_CHARACTER 0  //1 to include "LCD_set_character", 0 to leave it out(it needs the cursor address to be tracked)
+
+    #define LCD_ROWS    4   //Number of rows of the LCD(2 for 2x16, 4 for 4x20)
+    #define LCD_COLUMNS 20  //Number of columns of the LCD(16 for 2x16, 20 for 4x20)
+
+    #define LCD_FIELD_COUNT 0  //Max. number of display fields(see "LCD_field_add", 0 to disable)
+    #define LCD_FIELD_WIDTH 8  //Max. width of a display field in characters
+
+    #define LCD_FRAME_RATE 0     //Max. screen updates per second(see "LCD_frame_update", 0 to disable)
+    #define LCD_TICK_RATE  1000  //How many times per second "LCD_tick" is called
+
+    #define LCD_ANIM_COUNT 0  //Max. custom character animations(see "LCD_anim_add", max. 8, 0 to disable)
+
+    #define LCD_USE_PAGES 0  //1 to include page flipping(see "LCD_page_flip", only for LCDs with 1-2 rows and 20 columns or less)
+    #if LCD_USE_PAGES && LCD_ROWS > 2
+    #error "LCD_USE_PAGES needs an LCD with 1 or 2 rows(rows 3-4 already use the rest of the DDRAM lines)"
+    #endif
+    #if LCD_USE_PAGES && LCD_COLUMNS > 20
+    #error "LCD_USE_PAGES needs an LCD with 20 columns or less(2 pages have to fit into a DDRAM line)"
+    #endif
+
+    #define LCD_BIGNUM_COUNT  0  //Max. number of big-digit numbers(see "LCD_bignum_add", 0 to disable)
+    #define LCD_BIGNUM_DIGITS 4  //Max. digits of a big-digit number(each digit takes 3 columns + 1 space)
+    #define LCD_BIGNUM_ROWS   2  //Height of the big digits in rows(2 or 4)
+    #define LCD_BIGNUM_GLYPH  2  //First of the 3 CGRAM locations used by the big digits(0-5, 4 locations and 0-4 with LCD_CHARSET_A02)
+
+    #define LCD_VERIFY_CHUNK 4  //Cells checked by each "LCD_verify" call(needs LCD_USE_RW and the frame)
+
+    #define LCD_QUEUE_SIZE   0   //Max. characters waiting in "LCD_post_char" queue(power of 2, 0 to disable)
+    #define LCD_QUEUE_URGENT 1   //1 to send the queued characters in the middle of any write(0 to wait for "LCD_drain")
+
+    #define LCD_USE_BATCH 0  //1 to include command batching(see "LCD_batch_begin")
+
+    #define LCD_USE_PACKED 0  //1 to include "LCD_write_packed"(compressed texts made by "lcd_strings" in LCD Tools)
+
+    #define LCD_TRACE_SIZE 0  //Bus events kept by the trace(power of 2, see "LCD_trace_dump", 0 to disable)
+
+    #define LCD_USE_UTF8 0  //1 to include "LCD_write_utf8"(and its character tables)
+
+    #define LCD_CHARSET_A02 0  //Character ROM of the LCD used by "LCD_write_utf8"(0 for A00/japanese, 1 for A02/european)
+    #define LCD_UTF8_SLOTS  2  //CGRAM locations(7 and below) used for characters missing in the ROM(1-7, 0 to disable)
+    #if LCD_BIGNUM_COUNT > 0 && LCD_USE_UTF8 && LCD_UTF8_SLOTS > 0 && LCD_BIGNUM_GLYPH + 3 + LCD_CHARSET_A02 > 8 - LCD_UTF8_SLOTS
+    #error "The big digits and LCD_write_utf8 use the same CGRAM locations(lower LCD_BIGNUM_GLYPH or LCD_UTF8_SLOTS)"
+    #endif
     //*********************************************************//
 
 
@@ -75,9 +140,28 @@
     #define LCD_BUSY_DELAY           60                    //Minimum delay required by short commands[uS]
     #define LCD_BUSY_DELAY_EXTENDED (2300-LCD_BUSY_DELAY)  //Extra delay required by the longer commands[uS]
 
+    #if LCD_CALIBRATE && LCD_USE_RW && LCD_USE_TIMER
+    #define LCD_BUSY_SHORT           LCD_busy_short           //Delay given to short commands[uS](measured by "LCD_calibrate")
+    #define LCD_BUSY_LONG            LCD_busy_long            //Extra delay given to the longer commands[uS](measured by "LCD_calibrate")
+    #else
+    #define LCD_BUSY_SHORT           LCD_BUSY_DELAY           //Delay given to short commands[uS]
+    #define LCD_BUSY_LONG            LCD_BUSY_DELAY_EXTENDED  //Extra delay given to the longer commands[uS]
+    #endif
+
+    #if LCD_USE_TIMER
+    #define LCD_BUSY_TICKS_MAX      ((LCD_BUSY_DELAY+LCD_BUSY_DELAY_EXTENDED) * LCD_TIMER_TICKS_PER_US)                 //Longest possible wait[timer ticks]
+    #define LCD_BUSY_SET(delay)     (LCD_ready_at = (uint16_t)(LCD_TIMER + (delay) * LCD_TIMER_TICKS_PER_US))          //LCD will be ready after "delay"[uS] from now
+    #define LCD_BUSY_EXTEND(delay)  (LCD_ready_at += (uint16_t)((delay) * LCD_TIMER_TICKS_PER_US))                     //LCD will be ready "delay"[uS] later than before
+    #define LCD_BUSY_WAIT()         while( (uint16_t)(LCD_ready_at - LCD_TIMER - 1) < LCD_BUSY_TICKS_MAX )            //Wait for only the remaining time
+    #else
+    #define LCD_BUSY_SET(delay)     __delay_us(delay)  //No timer, give the delay right away
+    #define LCD_BUSY_EXTEND(delay)  __delay_us(delay)  //...
+    #define LCD_BUSY_WAIT()                            //(Nothing left to wait for)
+    #endif
+
     #define LCD_CMD_FUNCTION_SET     0x28  //Function Set(4-bit, 2 line, 5x8 dots)
-    #define LCD_CMD_DISPLAY_CONTROL  0x0C  //Display On/Off Control(Display on, cursor off, blinking off)
-    #define LCD_CMD_ENTRY_MODE       0x06  //Entry Mode Set(Increment, shift off)
+    #define LCD_CMD_DISPLAY_CONTROL  0x08  //Display On/Off Control(+ display, cursor and blinking bits)
+    #define LCD_CMD_ENTRY_MODE       0x04  //Entry Mode Set(+ increment and shift bits)
     #define LCD_CMD_CLEAR            0x01  //Clear Display
     #define LCD_CMD_RETURN_HOME      0x02  //Return Home(or shift reset)
     #define LCD_CMD_SHIFT_LEFT       0x18  //Shift Left
@@ -85,25 +169,99 @@
     #define LCD_CMD_CURSOR_INCREMENT 0x14  //Increment Cursor
     #define LCD_CMD_CURSOR_DECREMENT 0x10  //Decrement Cursor
     #define LCD_CMD_CGRAM_SET        0x40  //Set CGRAM Address
+    #define LCD_CMD_DDRAM_SET        0x80  //Set DDRAM Address
 
     #define LCD_CMD_DDRAM_LINE_1 (0x80-1)   //DDRAM address for line-1(-1 from row starting from 1 instead of 0)
     #define LCD_CMD_DDRAM_LINE_2 (0xC0-1)   //DDRAM address for line-2(-1 from row starting from 1 instead of 0)
     #define LCD_CMD_DDRAM_LINE_3 (0x80+19)  //DDRAM address for line-3(+19 from 3rd line being the continuation of line-1)
     #define LCD_CMD_DDRAM_LINE_4 (0xC0+19)  //DDRAM address for line-4(+19 from 4th line being the continuation of line-2)
+
+    #define LCD_MODE_DEFAULT    0b00010100                                      //Display on, cursor off, blinking off(bits 0-2), increment, shift off(bits 3-4)
+    #define LCD_DISPLAY_CONTROL (LCD_CMD_DISPLAY_CONTROL | (LCD_mode & 0b00000111))  //Display On/Off Control command with the current bits
+    #define LCD_ENTRY_MODE      (LCD_CMD_ENTRY_MODE | (LCD_mode >> 3))              //Entry Mode Set command with the current bits
+
+    /* The cursor address is only tracked if something puts the cursor back or checks where it is */
+    #define LCD_TRACK_ADDRESS (LCD_USE_SET_CHARACTER || LCD_USE_EXEC || LCD_BIGNUM_COUNT > 0 || LCD_ANIM_COUNT > 0 || LCD_QUEUE_SIZE > 0 || LCD_USE_BATCH || (LCD_USE_UTF8 && LCD_UTF8_SLOTS > 0) || (LCD_USE_RW && LCD_FRAME_RATE > 0))
+
+    #if LCD_CHARSET_A02
+    #define LCD_UTF8_RANGE_FIRST 0x00A0  //First code point of the range the ROM has in order(Latin-1)
+    #define LCD_UTF8_RANGE_LAST  0x00FF  //Last code point of the range
+    #define LCD_UTF8_RANGE_CODE  0xA0    //Character code of the first code point
+    #else
+    #define LCD_UTF8_RANGE_FIRST 0xFF61  //First code point of the range the ROM has in order(half-width katakana)
+    #define LCD_UTF8_RANGE_LAST  0xFF9F  //Last code point of the range
+    #define LCD_UTF8_RANGE_CODE  0xA1    //Character code of the first code point
+    #endif
+
+    #define LCD_PAGE_COUNT (40/LCD_COLUMNS)  //Pages that fit into the 40 characters of a DDRAM line
+
+    #define LCD_BIGNUM_MINUS 10  //Symbol number of '-' in the big-digit font(0-9 are the digits)
+    #define LCD_BIGNUM_BLANK 11  //Symbol number of an empty digit
+    #define LCD_BIG_UP (LCD_BIGNUM_GLYPH+0)  //Custom character with a bar at the top
+    #define LCD_BIG_LO (LCD_BIGNUM_GLYPH+1)  //Custom character with a bar at the bottom
+    #define LCD_BIG_UL (LCD_BIGNUM_GLYPH+2)  //Custom character with bars at the top and the bottom
+    #if LCD_CHARSET_A02
+    #define LCD_BIG_FU (LCD_BIGNUM_GLYPH+3)  //Full block(custom character, the A02 ROM doesn't have one)
+    #define LCD_BIGNUM_GLYPHS 4              //Custom characters used by the big digits
+    #else
+    #define LCD_BIG_FU ((char)0xFF)          //Full block(in the ROM)
+    #define LCD_BIGNUM_GLYPHS 3              //Custom characters used by the big digits
+    #endif
+    #define LCD_BIG_NO ' '                   //Empty cell
+
+    #define LCD_FRAME_DIRTY_BYTES ((LCD_COLUMNS+7)/8)  //Bytes needed for the changed marks of a row
+
+    #define LCD_PACKED_ESCAPE 0x1F  //Byte of a packed text telling that the next byte is a character(see "LCD_write_packed")
+
+    #define LCD_RESYNC_PROBE 0x12  //DDRAM address read back by "LCD_resync"(different nibbles, so a mixed up read can't match it)
+    //*********************************************************//
+    
+    
+    //**************** Bytecode of "LCD_exec" *****************//
+    #define LCD_OP_END     0x00  //End of the program
+    #define LCD_OP_ADDRESS 0x01  //+ address(see "LCD_AT"): Sets the cursor
+    #define LCD_OP_WRITE   0x02  //+ count + characters: Writes the characters
+    #define LCD_OP_FILL    0x03  //+ count + character: Writes the same character "count" times
+    #define LCD_OP_GLYPH   0x04  //+ location + 8 pattern bytes: Changes a custom character(cursor doesn't move)
+    #define LCD_OP_CONFIG  0x05  //+ mode(LCD_MODE_... bits below): Sets the display and entry mode(entry mode after the program)
+    #define LCD_OP_CLEAR   0x06  //Clears the screen
+    #define LCD_OP_VALUE   0x07  //+ index + width + f_digit: Writes values[index] right aligned(max. 12 wide, see "LCD_field_set")
+
+    #define LCD_MODE_BLINK     0b00000001  //Cursor blinking on
+    #define LCD_MODE_CURSOR    0b00000010  //Cursor on
+    #define LCD_MODE_DISPLAY   0b00000100  //Display on
+    #define LCD_MODE_SHIFT     0b00001000  //Entry shift on
+    #define LCD_MODE_INCREMENT 0b00010000  //Entry increment(decrement if not set)
+
+    #define LCD_AT(row, column) ( ((row) == 1 ? 0x00 : (row) == 2 ? 0x40 : (row) == 3 ? 0x14 : 0x54) + (column) - 1 )  //DDRAM address of a location(for "LCD_OP_ADDRESS")
     //*********************************************************//
     
     
     //******************* Dependent Includes ******************//
     #include <xc.h>
     #include <stdint.h>
-    #include <math.h>
     //*********************************************************//
     
     
     //****************** Function prototypes ******************//
+    void LCD_trace_record(uint8_t);
     void LCD_pulse_clock(void);
+    void LCD_write_byte(char);
+    void LCD_address_step(uint8_t);
+    void LCD_batch_flush(void);
+    uint8_t LCD_batch_hold(uint8_t);
+    uint8_t LCD_batch_data(char);
     void LCD_write_command(char);
+    uint8_t LCD_entry_forward(void);
+    void LCD_entry_restore(uint8_t);
+    void LCD_preempt(void);
     void LCD_write_data(char);  
+    char* LCD_convert_digits(char*, uint32_t);
+    void LCD_format_fixed(char*, uint8_t, uint8_t, int32_t);
+    uint8_t LCD_read_byte(uint8_t);
+    void LCD_sync(void);
+    void LCD_calibrate(void);
+    void LCD_glyph_remember(const char*, uint8_t);
     
     void LCD_init(void);
     void LCD_cursor_set(uint8_t, uint8_t);
@@ -116,20 +274,141 @@
     void LCD_shift_reset(void);
     void LCD_shift_left(void);
     void LCD_shift_right(void);    
+    void LCD_page_cursor_set(uint8_t, uint8_t, uint8_t);
+    void LCD_page_flip(uint8_t);
+    void LCD_page_clear(uint8_t);
     void LCD_configure_entry_id(uint8_t);
     void LCD_configure_entry_shift(uint8_t);
-    void LCD_add_character(char*, uint8_t);
+    void LCD_add_character(const char*, uint8_t);
+    void LCD_set_character(const char*, uint8_t);
     
-    void LCD_write_string(char*);
+    void LCD_write_buffer(const char*, uint16_t);
+    void LCD_write_string(const char*);
+    void LCD_write_packed(const char*, const char * const*);
+    void LCD_write_text(const char*, uint8_t*, uint8_t*);
     void LCD_write_char(char);
+    void LCD_write_utf8(const char*);
+    void LCD_utf8_glyphs(const uint16_t*, const char*, uint8_t);
     void LCD_write_variable(int32_t, uint8_t);
+    void LCD_write_hex(uint32_t, uint8_t, uint8_t);
+    void LCD_write_bin(uint32_t, uint8_t, uint8_t);
     void LCD_write_float(float, uint8_t, uint8_t);
+    void LCD_exec(const uint8_t*, const int32_t*);
+    
+    void LCD_field_add(uint8_t, uint8_t, uint8_t, uint8_t, uint8_t);
+    void LCD_field_set(uint8_t, int32_t);
+    
+    void LCD_bignum_add(uint8_t, uint8_t, uint8_t, uint8_t, uint8_t);
+    void LCD_bignum_set(uint8_t, int32_t);
+    
+    void LCD_tick(void);
+    void LCD_frame_clear(void);
+    void LCD_frame_write_char(uint8_t, uint8_t, char);
+    void LCD_frame_write_string(uint8_t, uint8_t, const char*);
+    uint8_t LCD_frame_update(void);
+    uint8_t LCD_verify(void);
+    uint8_t LCD_resync(void);
+    
+    void LCD_anim_add(uint8_t, uint8_t, const char*, uint8_t, uint16_t);
+    void LCD_anim_stop(uint8_t);
+    uint8_t LCD_anim_update(void);
+    
+    uint8_t LCD_post_char(uint8_t, uint8_t, char);
+    uint8_t LCD_post_string(uint8_t, uint8_t, const char*);
+    uint8_t LCD_drain(void);
+    
+    void LCD_batch_begin(void);
+    uint16_t LCD_batch_end(void);
+    
+    void LCD_trace_dump(void (*)(char));
     //*********************************************************//
     
     
     //******************** Global Variables *******************//
-    extern uint8_t LCD_display_control;
-    extern uint8_t LCD_entry_mode;
+    extern uint8_t LCD_mode;
+    extern uint8_t LCD_address;
+    extern uint8_t LCD_shift;
+    extern uint8_t LCD_cgram;
+    extern uint16_t LCD_ready_at;
+    extern uint16_t LCD_busy_short;
+    extern uint16_t LCD_busy_long;
+    
+    #if LCD_FIELD_COUNT > 0
+    extern uint8_t LCD_field_row[LCD_FIELD_COUNT];
+    extern uint8_t LCD_field_column[LCD_FIELD_COUNT];
+    extern uint8_t LCD_field_width[LCD_FIELD_COUNT];
+    extern uint8_t LCD_field_f_digit[LCD_FIELD_COUNT];
+    extern char    LCD_field_text[LCD_FIELD_COUNT][LCD_FIELD_WIDTH];
+    #endif
+    
+    #if LCD_BIGNUM_COUNT > 0
+    extern uint8_t LCD_bignum_row[LCD_BIGNUM_COUNT];
+    extern uint8_t LCD_bignum_column[LCD_BIGNUM_COUNT];
+    extern uint8_t LCD_bignum_digits[LCD_BIGNUM_COUNT];
+    extern uint8_t LCD_bignum_f_digit[LCD_BIGNUM_COUNT];
+    extern uint8_t LCD_bignum_shown[LCD_BIGNUM_COUNT][LCD_BIGNUM_DIGITS];
+    #endif
+    
+    #if LCD_FRAME_RATE > 0
+    extern char             LCD_frame_buffer[LCD_ROWS][LCD_COLUMNS];
+    extern uint8_t          LCD_frame_dirty[LCD_ROWS][LCD_FRAME_DIRTY_BYTES];
+    #endif
+    #if LCD_FRAME_RATE > 0 || LCD_ANIM_COUNT > 0
+    extern uint16_t         LCD_frame_ticks;
+    extern volatile uint8_t LCD_frame_due;
+    #endif
+    
+    #if LCD_ANIM_COUNT > 0
+    extern const char * volatile LCD_anim_frames[LCD_ANIM_COUNT];
+    extern uint8_t               LCD_anim_location[LCD_ANIM_COUNT];
+    extern uint8_t               LCD_anim_count[LCD_ANIM_COUNT];
+    extern uint8_t               LCD_anim_frame[LCD_ANIM_COUNT];
+    extern uint16_t              LCD_anim_period[LCD_ANIM_COUNT];
+    extern uint16_t              LCD_anim_ticks[LCD_ANIM_COUNT];
+    extern volatile uint8_t      LCD_anim_due[LCD_ANIM_COUNT];
+    #endif
+    
+    #if LCD_USE_RW && LCD_FRAME_RATE > 0
+    extern char        LCD_glyph_pattern[8][8];
+    extern uint8_t     LCD_glyph_loaded;
+    extern uint8_t     LCD_verify_row;
+    extern uint8_t     LCD_verify_column;
+    #endif
+    
+    #if LCD_USE_UTF8 && LCD_UTF8_SLOTS > 0
+    extern const uint16_t *LCD_utf8_glyph_points;
+    extern const char     *LCD_utf8_glyph_patterns;
+    extern uint8_t         LCD_utf8_glyph_count;
+    extern uint16_t        LCD_utf8_slot_points[LCD_UTF8_SLOTS];
+    extern uint8_t         LCD_utf8_slot_next;
+    #endif
+    
+    #if LCD_QUEUE_SIZE > 0
+    extern volatile uint8_t LCD_queue_address[LCD_QUEUE_SIZE];
+    extern volatile char    LCD_queue_character[LCD_QUEUE_SIZE];
+    extern volatile uint8_t LCD_queue_head;
+    extern volatile uint8_t LCD_queue_tail;
+    #endif
+    
+    #if LCD_USE_BATCH
+    extern uint8_t  LCD_batch_open;
+    extern uint8_t  LCD_batch_moved;
+    extern uint8_t  LCD_batch_from;
+    extern uint8_t  LCD_batch_lost;
+    extern uint8_t  LCD_batch_entry;
+    extern uint8_t  LCD_batch_entry_held;
+    extern int8_t   LCD_batch_shift;
+    extern uint8_t  LCD_batch_blank[16];
+    extern uint16_t LCD_batch_saved;
+    #endif
+    
+    #if LCD_TRACE_SIZE > 0
+    extern uint16_t LCD_trace_time[LCD_TRACE_SIZE];
+    extern uint8_t  LCD_trace_event[LCD_TRACE_SIZE];
+    extern uint16_t LCD_trace_count;
+    extern uint16_t LCD_trace_next;
+    extern uint16_t LCD_trace_lost;
+    #endif
     //*********************************************************//
     
     
@@ -33,14 +33,18 @@
  * (Character font needs to be 5x8!)
  * @param *pattern: Binary pattern of the character\n
  * (Can be generated by googling "LCD custom character
- * generator".)
+ * generator".)\n
+ * (Declare the pattern as "const" to keep it in program memory
+ * instead of RAM, it can be changed or go out of scope after the call)
  * @param location: CGRAM address to put the character(0-7)
  */
-void LCD_add_character(char *pattern, uint8_t address){
+void LCD_add_character(const char *pattern, uint8_t address){
     
     /* Set the CGRAM address with the passed offset(address).
      * Multiply the offset by 8(shift left by 3), since each
-     * "CGRAM location" has 8 addresses for 8 rows of character.*/  
+     * "CGRAM location" has 8 addresses for 8 rows of character.
+     * The rows go downwards, so the entry mode has to increment.*/  
+    uint8_t mode = LCD_entry_forward();
     LCD_write_command( LCD_CMD_CGRAM_SET + (uint8_t)(address<<3) );
 
     /* Send the pattern */
@@ -48,6 +52,12 @@ void LCD_add_character(char *pattern, uint8_t address){
         LCD_write_data(pattern[i]);
     }
     
+#if LCD_USE_RW && LCD_FRAME_RATE > 0
+    /* Remember the pattern so "LCD_verify" can check it */
+    LCD_glyph_remember(pattern, address);
+#endif
+    
     /* Set cursor to 1,1 to point the cursor back from "CGRAM" to "DDRAM" */
+    LCD_entry_restore(mode);
     LCD_cursor_set(1, 1);
 }
\ No newline at end of file
@@ -0,0 +1,55 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_TRACK_ADDRESS
+
+/* Initialize the global variables */
+uint8_t LCD_address;  //DDRAM address the cursor is at(tracked, without reading the LCD)
+
+
+/**
+ * Moves the tracked DDRAM address by 1 the same way the LCD moves its
+ * address counter(line 1 and line 2 continue into each other)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param increment: Non-zero to increment, 0 to decrement
+ */
+void LCD_address_step(uint8_t increment){
+    
+    if(increment){
+        if(LCD_address == 0x27)      LCD_address = 0x40;  //End of line-1 continues from line-2
+        else if(LCD_address == 0x67) LCD_address = 0x00;  //End of line-2 continues from line-1
+        else                         LCD_address++;
+    }
+    else{
+        if(LCD_address == 0x40)      LCD_address = 0x27;  //Start of line-2 continues from line-1
+        else if(LCD_address == 0x00) LCD_address = 0x67;  //Start of line-1 continues from line-2
+        else                         LCD_address--;
+    }
+}
+
+#endif
\ No newline at end of file
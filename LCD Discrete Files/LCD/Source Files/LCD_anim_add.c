@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_ANIM_COUNT > 0
+
+/* Initialize the global variables */
+const char * volatile LCD_anim_frames[LCD_ANIM_COUNT];    //Patterns of all frames of each animation(NULL if stopped)
+uint8_t               LCD_anim_location[LCD_ANIM_COUNT];  //CGRAM location each animation is played on
+uint8_t               LCD_anim_count[LCD_ANIM_COUNT];     //Number of frames of each animation
+uint8_t               LCD_anim_frame[LCD_ANIM_COUNT];     //Frame each animation is showing
+uint16_t              LCD_anim_period[LCD_ANIM_COUNT];    //Ticks each frame is shown for
+uint16_t              LCD_anim_ticks[LCD_ANIM_COUNT];     //Ticks passed since the last frame
+volatile uint8_t      LCD_anim_due[LCD_ANIM_COUNT];       //Set when the next frame of the animation is due
+
+
+/**
+ * Plays an animation on a custom character, so every cell showing that
+ * character is animated at once without being written\n
+ * (The frames are changed by "LCD_anim_update" at the rate counted by
+ * "LCD_tick", the first frame is shown right away)\n
+ * (Cursor location is preserved)
+ * @param id: Animation number(0 to LCD_ANIM_COUNT-1, adding an animation
+ * with the same number replaces the old one)
+ * @param location: CGRAM location to play the animation on(0-7)
+ * @param *frames: Binary patterns of all frames one after the other(8
+ * bytes each)\n
+ * (Declare the frames as "const" to keep them in program memory
+ * instead of RAM, they are read while the animation plays so they have
+ * to stay valid until "LCD_anim_stop")
+ * @param count: Number of frames
+ * @param period: How long each frame is shown for[ticks of "LCD_tick"]
+ */
+void LCD_anim_add(uint8_t id, uint8_t location, const char *frames, uint8_t count, uint16_t period){
+    
+    /* Stop the old animation while changing it("LCD_tick" skips it) */
+    LCD_anim_frames[id] = 0;
+    
+    LCD_anim_location[id] = location;
+    LCD_anim_count[id]    = count;
+    LCD_anim_frame[id]    = 0;
+    LCD_anim_period[id]   = period;
+    LCD_anim_ticks[id]    = 0;
+    LCD_anim_due[id]      = 0;
+    
+    /* Show the first frame and start playing */
+    LCD_set_character(frames, location);
+    LCD_anim_frames[id] = frames;
+}
+
+#endif
\ No newline at end of file
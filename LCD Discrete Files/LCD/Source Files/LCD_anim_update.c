@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_ANIM_COUNT > 0
+
+/**
+ * Shows the next frame of the animations whose time has come, has to be
+ * called periodically by the main code(e.g. from the main loop)\n
+ * (Each frame costs 9 bytes no matter how many cells show it, plus 1
+ * byte to put the cursor back if any frame was shown)\n
+ * (Cursor location is preserved)
+ * @return Number of frames shown
+ */
+uint8_t LCD_anim_update(){
+    
+    uint8_t shown  = 0;            //Number of frames shown
+    uint8_t cursor = LCD_address;  //Cursor location to be restored
+    uint8_t mode   = LCD_mode;     //Entry mode to be restored
+    
+    for(uint8_t i=0 ; i < LCD_ANIM_COUNT ; i++){
+        
+        /* Skip the animations that aren't due(or were stopped) */
+        if(!LCD_anim_due[i]) continue;
+        LCD_anim_due[i] = 0;
+        if(!LCD_anim_frames[i]) continue;
+        
+        /* Move onto the next frame(back to the first one after the last one) */
+        if(++LCD_anim_frame[i] >= LCD_anim_count[i]) LCD_anim_frame[i] = 0;
+        const char *pattern = LCD_anim_frames[i] + ((uint16_t)LCD_anim_frame[i] << 3);
+        
+        /* Send the frame into the CGRAM location(see "LCD_add_character") */
+        if(!shown) mode = LCD_entry_forward();
+        LCD_write_command( LCD_CMD_CGRAM_SET + (uint8_t)(LCD_anim_location[i]<<3) );
+        LCD_write_buffer(pattern, 8);
+        
+#if LCD_USE_RW && LCD_FRAME_RATE > 0
+        /* Remember the pattern so "LCD_verify" can check it */
+        LCD_glyph_remember(pattern, LCD_anim_location[i]);
+#endif
+        
+        shown++;
+    }
+    
+    /* Point the cursor back from "CGRAM" to the saved "DDRAM" address(once for all the frames) */
+    if(shown){
+        LCD_entry_restore(mode);
+        LCD_write_command(LCD_CMD_DDRAM_SET | cursor);
+    }
+    
+    return shown;
+}
+
+#endif
\ No newline at end of file
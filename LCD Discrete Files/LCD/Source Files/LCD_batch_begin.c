@@ -0,0 +1,66 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_BATCH
+
+/* Initialize the global variables */
+uint8_t  LCD_batch_open;        //1 between "LCD_batch_begin" and "LCD_batch_end"
+uint8_t  LCD_batch_moved;       //1 if cursor moves are held back
+uint8_t  LCD_batch_from;        //Address the cursor was at before the held moves
+uint8_t  LCD_batch_lost;        //1 if the LCD isn't at "LCD_address"(in CGRAM or moved by reading)
+uint8_t  LCD_batch_entry;       //Entry mode command the LCD has
+uint8_t  LCD_batch_entry_held;  //Held entry mode command(0 if none)
+int8_t   LCD_batch_shift;       //Held display shifts(+ left, - right)
+uint8_t  LCD_batch_blank[16];   //Bits of the DDRAM addresses still empty since a clear in the batch
+uint16_t LCD_batch_saved;       //Bytes left out in the current batch
+
+
+/**
+ * Starts a batch, the commands sent until "LCD_batch_end" are held back
+ * and sent as a shorter sequence that leaves the LCD in the same state\n
+ * (Cursor moves are merged into one, display shifts that cancel each
+ * other and repeated entry modes are left out, so are the empty spaces
+ * written on the cells a clear in the batch already emptied)\n
+ * (Characters still show up as they are written, only the commands
+ * are delayed)
+ */
+void LCD_batch_begin(){
+    
+    /* Nothing is held yet, the LCD is where the library left it */
+    LCD_batch_moved      = 0;
+    LCD_batch_lost       = 0;
+    LCD_batch_shift      = 0;
+    LCD_batch_entry      = LCD_ENTRY_MODE;
+    LCD_batch_entry_held = 0;
+    LCD_batch_saved      = 0;
+    for(uint8_t i=0 ; i < 16 ; i++) LCD_batch_blank[i] = 0;  //(Nothing is known to be empty before a clear)
+    
+    LCD_batch_open = 1;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_BATCH
+
+/**
+ * Decides if a character can be left out inside a batch(and sends the
+ * held commands first if it can't)\n
+ * (Has to be called before the data changes the tracked address)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param data: Character to be written
+ * @return 1 if the character is left out, 0 if it has to be sent
+ * now(data mode is entered)
+ */
+uint8_t LCD_batch_data(char data){
+    
+    uint8_t bit = (uint8_t)(1 << (LCD_address & 7));  //Bit of the cell in "LCD_batch_blank"
+    
+    /*---------- An empty space on an empty cell is only a cursor move(not with the entry shift) ----------*/
+    if( data == ' ' && !LCD_batch_lost && !(LCD_mode & 0b00001000) && (LCD_batch_blank[LCD_address >> 3] & bit) ){
+        if(!LCD_batch_moved){
+            LCD_batch_moved = 1;
+            LCD_batch_from  = LCD_address;
+        }
+        LCD_batch_saved++;
+        return 1;
+    }
+    
+    /*---------- Otherwise bring the LCD up to date and mark the cell as written ----------*/
+    LCD_batch_flush();
+    if(!LCD_batch_lost) LCD_batch_blank[LCD_address >> 3] &= (uint8_t)~bit;
+    
+    LCD_RS_LAT = 1; //Enter data mode
+    return 0;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_BATCH
+
+/**
+ * Sends the commands held back by the batch(only the ones that still
+ * change something)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ */
+void LCD_batch_flush(){
+    
+    LCD_RS_LAT = 0; //Enter command mode(sent directly, "LCD_write_command" would hold them again)
+    
+    /*---------- Display shifts(the ones that cancel each other are left out) ----------*/
+    while(LCD_batch_shift > 0){
+        LCD_write_byte(LCD_CMD_SHIFT_LEFT);
+        LCD_batch_shift--;
+        LCD_batch_saved--;
+    }
+    while(LCD_batch_shift < 0){
+        LCD_write_byte(LCD_CMD_SHIFT_RIGHT);
+        LCD_batch_shift++;
+        LCD_batch_saved--;
+    }
+    
+    /*---------- Entry mode(only if it's different from the one the LCD has) ----------*/
+    if(LCD_batch_entry_held){
+        if(LCD_batch_entry_held != LCD_batch_entry){
+            LCD_write_byte(LCD_batch_entry_held);
+            LCD_batch_entry = LCD_batch_entry_held;
+            LCD_batch_saved--;
+        }
+        LCD_batch_entry_held = 0;
+    }
+    
+    /*---------- Cursor moves(one set address for all of them, if the cursor moved at all) ----------*/
+    if(LCD_batch_moved){
+        if(LCD_batch_lost || LCD_address != LCD_batch_from){
+            LCD_write_byte(LCD_CMD_DDRAM_SET | LCD_address);
+            LCD_batch_lost = 0;
+            LCD_batch_saved--;
+        }
+        LCD_batch_moved = 0;
+    }
+}
+
+#endif
\ No newline at end of file
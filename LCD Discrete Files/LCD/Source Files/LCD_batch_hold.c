@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_BATCH
+
+/**
+ * Decides if a command can be held back inside a batch(and sends the
+ * held ones first if it can't)\n
+ * (Has to be called before the command changes the tracked address)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param code: Command to be sent
+ * @return 1 if the command is held back, 0 if it has to be sent now
+ */
+uint8_t LCD_batch_hold(uint8_t code){
+    
+    /*---------- Cursor moves(merged into one set address) ----------*/
+    if( (code & LCD_CMD_DDRAM_SET) || ((code & 0b11111000) == LCD_CMD_CURSOR_DECREMENT && (LCD_batch_moved || !LCD_batch_lost)) ){
+        if(!LCD_batch_moved){
+            LCD_batch_moved = 1;
+            LCD_batch_from  = LCD_address;
+        }
+        LCD_batch_saved++;
+        return 1;
+    }
+    
+    /*---------- Display shifts(added up) ----------*/
+    if(code == LCD_CMD_SHIFT_LEFT || code == LCD_CMD_SHIFT_RIGHT){
+        LCD_batch_shift += (code == LCD_CMD_SHIFT_LEFT) ? 1 : -1;
+        LCD_batch_saved++;
+        return 1;
+    }
+    
+    /*---------- Entry mode(only the last one counts) ----------*/
+    if((code & 0b11111100) == LCD_CMD_ENTRY_MODE){
+        LCD_batch_entry_held = code;
+        LCD_batch_saved++;
+        return 1;
+    }
+    
+    /*---------- Clear Display/Return Home(cancel the held shifts and moves) ----------*/
+    if(code == LCD_CMD_CLEAR || (code & 0b11111110) == LCD_CMD_RETURN_HOME){
+        LCD_batch_shift = 0;
+        LCD_batch_moved = 0;
+        LCD_batch_lost  = 0;
+        if(code == LCD_CMD_CLEAR){
+            LCD_batch_entry |= 0b00000010;                          //(Clear sets the entry mode to increment)
+            for(uint8_t i=0 ; i < 16 ; i++) LCD_batch_blank[i] = 0xFF;  //Every cell is empty
+        }
+        return 0;
+    }
+    
+    /*---------- Set CGRAM Address(the held moves don't matter anymore) ----------*/
+    if((code & 0b11000000) == LCD_CMD_CGRAM_SET){
+        LCD_batch_moved = 0;
+        LCD_batch_flush();
+        LCD_batch_lost = 1;
+        return 0;
+    }
+    
+    /*---------- Anything else ----------*/
+    LCD_batch_flush();
+    return 0;
+}
+
+#endif
\ No newline at end of file
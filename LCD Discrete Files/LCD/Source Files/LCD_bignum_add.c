@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_BIGNUM_COUNT > 0
+
+/* Initialize the global variables */
+uint8_t LCD_bignum_row[LCD_BIGNUM_COUNT];                     //Top row of each big-digit number
+uint8_t LCD_bignum_column[LCD_BIGNUM_COUNT];                  //Left column of each big-digit number
+uint8_t LCD_bignum_digits[LCD_BIGNUM_COUNT];                  //Number of digits of each big-digit number
+uint8_t LCD_bignum_f_digit[LCD_BIGNUM_COUNT];                 //Fractional digits of each big-digit number
+uint8_t LCD_bignum_shown[LCD_BIGNUM_COUNT][LCD_BIGNUM_DIGITS];  //Symbol shown on each digit(0xFF if unknown)
+
+
+/* Patterns of the custom characters the big digits are built from */
+static const char LCD_bignum_glyphs[LCD_BIGNUM_GLYPHS][8] = {
+    { 0b11111, 0b11111, 0b11111, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 },  //Bar at the top
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b11111, 0b11111, 0b11111 },  //Bar at the bottom
+    { 0b11111, 0b11111, 0b11111, 0b00000, 0b00000, 0b11111, 0b11111, 0b11111 },  //Bars at the top and the bottom
+#if LCD_CHARSET_A02
+    { 0b11111, 0b11111, 0b11111, 0b11111, 0b11111, 0b11111, 0b11111, 0b11111 }   //Full block
+#endif
+};
+
+
+/**
+ * Declares a number that is shown with big digits(3 columns wide and
+ * "LCD_BIGNUM_ROWS" rows high) at a fixed location\n
+ * (Loads the 3 custom characters the digits are built from into the
+ * CGRAM, starting from "LCD_BIGNUM_GLYPH", plus a full block with
+ * "LCD_CHARSET_A02" since that ROM doesn't have one)\n
+ * (The number is repainted with "LCD_bignum_set", only the digits that
+ * changed since the last call are sent to the LCD. Call this again to
+ * repaint all digits, e.g. after "LCD_clear")\n
+ * (Max. "LCD_BIGNUM_COUNT" numbers can be declared at a time)
+ * @param id: Number's id(0 to LCD_BIGNUM_COUNT-1)
+ * @param row: Top row of the digits(1-4)
+ * @param column: Left column of the first digit(1-20)
+ * @param digits: Number of big digits(max. LCD_BIGNUM_DIGITS)\n
+ * (Takes digits*4-1 columns, digits are separated by an empty column)
+ * @param f_digit: How many digits of the value are fractional\n
+ * (The decimal point is shown in the empty column before them)
+ */
+void LCD_bignum_add(uint8_t id, uint8_t row, uint8_t column, uint8_t digits, uint8_t f_digit){
+    
+    /* Limit the digits to the space reserved for each number */
+    if(digits > LCD_BIGNUM_DIGITS) digits = LCD_BIGNUM_DIGITS;
+    
+    /* Save the number's format */
+    LCD_bignum_row[id]     = row;
+    LCD_bignum_column[id]  = column;
+    LCD_bignum_digits[id]  = digits;
+    LCD_bignum_f_digit[id] = f_digit;
+    
+    /* Load the custom characters(without moving the cursor) */
+    for(uint8_t i=0 ; i < LCD_BIGNUM_GLYPHS ; i++){
+        LCD_set_character(LCD_bignum_glyphs[i], LCD_BIGNUM_GLYPH + i);
+    }
+    
+    /* Forget the shown digits so the first "LCD_bignum_set" paints all of them */
+    for(uint8_t i=0 ; i < LCD_BIGNUM_DIGITS ; i++){
+        LCD_bignum_shown[id][i] = 0xFF;
+    }
+}
+
+#endif
\ No newline at end of file
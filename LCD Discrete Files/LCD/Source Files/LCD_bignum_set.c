@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_BIGNUM_COUNT > 0
+
+/* Characters of each symbol(0-9, '-', empty), 3 columns for each row */
+#if LCD_BIGNUM_ROWS == 4
+static const char LCD_bignum_font[12][4][3] = {
+    { {LCD_BIG_FU, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU} },  //0
+    { {LCD_BIG_UP, LCD_BIG_FU, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_FU, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_FU, LCD_BIG_NO}, {LCD_BIG_LO, LCD_BIG_FU, LCD_BIG_LO} },  //1
+    { {LCD_BIG_UP, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_LO} },  //2
+    { {LCD_BIG_UP, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU} },  //3
+    { {LCD_BIG_FU, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU} },  //4
+    { {LCD_BIG_FU, LCD_BIG_UP, LCD_BIG_UP}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_LO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU} },  //5
+    { {LCD_BIG_FU, LCD_BIG_UP, LCD_BIG_UP}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_LO}, {LCD_BIG_FU, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU} },  //6
+    { {LCD_BIG_UP, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU} },  //7
+    { {LCD_BIG_FU, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU} },  //8
+    { {LCD_BIG_FU, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU} },  //9
+    { {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_LO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO} },  //-
+    { {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO} }   //Empty
+};
+#else
+static const char LCD_bignum_font[12][2][3] = {
+    { {LCD_BIG_FU, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU} },  //0
+    { {LCD_BIG_UP, LCD_BIG_FU, LCD_BIG_NO}, {LCD_BIG_LO, LCD_BIG_FU, LCD_BIG_LO} },  //1
+    { {LCD_BIG_UL, LCD_BIG_UL, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_LO} },  //2
+    { {LCD_BIG_UL, LCD_BIG_UL, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU} },  //3
+    { {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU} },  //4
+    { {LCD_BIG_FU, LCD_BIG_UL, LCD_BIG_UL}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU} },  //5
+    { {LCD_BIG_FU, LCD_BIG_UL, LCD_BIG_UL}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU} },  //6
+    { {LCD_BIG_UP, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU} },  //7
+    { {LCD_BIG_FU, LCD_BIG_UL, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU} },  //8
+    { {LCD_BIG_FU, LCD_BIG_UL, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU} },  //9
+    { {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_LO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO} },  //-
+    { {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO} }   //Empty
+};
+#endif
+
+
+/**
+ * Shows a new value on a big-digit number declared with "LCD_bignum_add"\n
+ * (Only the digits that differ from the last shown value are written,
+ * e.g. 123 -> 124 costs 1 cursor set and 4 characters for each row)\n
+ * (If the value doesn't fit, all digits show '-')\n
+ * (Cursor will point to the right side of the last changed digit's bottom row)
+ * @param id: Number's id(0 to LCD_BIGNUM_COUNT-1)
+ * @param value: Value to be shown(fixed-point, scaled by the number's f_digit)
+ */
+void LCD_bignum_set(uint8_t id, int32_t value){
+    
+    uint8_t symbol[LCD_BIGNUM_DIGITS];  //New symbol of each digit(0-9, LCD_BIGNUM_MINUS or LCD_BIGNUM_BLANK)
+    char text[LCD_BIGNUM_DIGITS*4];     //Characters of one row of the changed digits
+    char buffer[10];                    //Buffer to hold the digits(max. 10 digits for 32-bit)
+    char *digits;                       //Pointer to the first digit in the buffer
+    uint8_t count;                      //Variable to hold the number of digits
+    uint8_t length;                     //Total number of symbols of the value
+    uint8_t position;                   //Position to place the next symbol(from right to left)
+    uint8_t width   = LCD_bignum_digits[id];
+    uint8_t f_digit = LCD_bignum_f_digit[id];
+    uint8_t mode    = LCD_mode;             //Entry mode to be restored
+    
+    /*----- Turn negative numbers into positive(unsigned, so -2147483648 fits too) -----*/
+    uint32_t magnitude = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+    
+    /*---------- Convert the value into digits ----------*/
+    digits = LCD_convert_digits(buffer + sizeof(buffer), magnitude);
+    count  = (uint8_t)((buffer + sizeof(buffer)) - digits);
+    
+    /*---------- Calculate the total length(digits, leading '0' of "0.x" and '-') ----------*/
+    length = count;
+    if(length <= f_digit) length = f_digit + 1;
+    if(value < 0) length++;
+    
+    /*---------- Place the symbols right aligned(or '-' if it doesn't fit) ----------*/
+    position = width;
+    if(length > width){
+        while(position) symbol[--position] = LCD_BIGNUM_MINUS;
+    }
+    else{
+        for(uint8_t i=0 ; i < f_digit ; i++){                                //Place the fractional digits
+            symbol[--position] = count ? (uint8_t)(digits[--count] - '0') : 0;  //(with leading zeros if needed)
+        }
+        do{                                                                  //Place the integer digits
+            symbol[--position] = count ? (uint8_t)(digits[--count] - '0') : 0;  //(at least one digit)
+        }while(count);
+        if(value < 0) symbol[--position] = LCD_BIGNUM_MINUS;                 //Place the sign
+        while(position) symbol[--position] = LCD_BIGNUM_BLANK;               //Fill the rest with empty digits
+    }
+    
+    /*---------- Write only the runs of digits that changed ----------*/
+    for(uint8_t i=0 ; i < width ; i++){
+        
+        if(symbol[i] == LCD_bignum_shown[id][i]) continue;  //Skip the unchanged digits
+        
+        uint8_t start = i;                                  //Find the end of the changed run
+        while(i < width && symbol[i] != LCD_bignum_shown[id][i]){
+            LCD_bignum_shown[id][i] = symbol[i];            //Remember the new symbol
+            i++;
+        }
+        
+        /* Write the run row by row, each digit with the empty column on its left(except the first digit) */
+        if(mode == LCD_mode) mode = LCD_entry_forward();  //(Rows are written from left to right)
+        for(uint8_t r=0 ; r < LCD_BIGNUM_ROWS ; r++){
+            length = 0;
+            for(uint8_t d=start ; d < i ; d++){
+                if(d) text[length++] = (d == width - f_digit && r == LCD_BIGNUM_ROWS - 1) ? '.' : ' ';
+                text[length++] = LCD_bignum_font[symbol[d]][r][0];
+                text[length++] = LCD_bignum_font[symbol[d]][r][1];
+                text[length++] = LCD_bignum_font[symbol[d]][r][2];
+            }
+            LCD_cursor_set(LCD_bignum_row[id] + r, LCD_bignum_column[id] + start*4 - (start ? 1 : 0));
+            LCD_write_buffer(text, length);
+        }
+    }
+    LCD_entry_restore(mode);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_CALIBRATE && LCD_USE_RW && LCD_USE_TIMER
+
+/* Initialize the global variables */
+uint16_t LCD_busy_short = LCD_BUSY_DELAY;           //Delay given to short commands[uS](measured by "LCD_calibrate")
+uint16_t LCD_busy_long  = LCD_BUSY_DELAY_EXTENDED;  //Extra delay given to the longer commands[uS](measured by "LCD_calibrate")
+
+
+/**
+ * Measures how long the LCD takes for a short command, a data write and
+ * clearing the screen by reading the busy flag, and gives these delays(+ the
+ * margin) to every command after it instead of the worst case ones\n
+ * (The address counter is updated about 4uS(tADD) after the busy flag
+ * clears, the margin has to stay above this, 25% of the usual 37uS does)\n
+ * (Called once by "LCD_init", the busy flag isn't read by the writes, so
+ * "R/W" can stay low afterwards)\n
+ * (If the LCD doesn't answer as expected the worst case delays are kept)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ */
+void LCD_calibrate(){
+    
+    static const char command[3] = {LCD_CMD_DDRAM_SET | LCD_RESYNC_PROBE, ' ', LCD_CMD_CLEAR};  //Short command, data(wiped by the clear), long command
+    uint8_t address[3] = {LCD_RESYNC_PROBE, LCD_RESYNC_PROBE - 1, 0};                          //Address expected after each command
+    uint16_t ticks[3];  //Measured delay of each command[timer ticks]
+    uint16_t start;     //Timer value when the command was sent
+    uint8_t value;      //Busy flag and address read from the LCD
+    uint32_t delay;     //Measured delay with the margin added[uS]
+    
+    /* The data write moves the address with the entry mode */
+    if(LCD_mode & 0b00010000) address[1] = LCD_RESYNC_PROBE + 1;
+    
+    for(uint8_t i = 0; i < 3; i++){
+        
+        /*---------- Send the command and note when it was sent ----------*/
+        if(i == 1) LCD_write_data(command[i]);
+        else       LCD_write_command(command[i]);
+        start = (uint16_t)(LCD_ready_at - LCD_BUSY_SHORT * LCD_TIMER_TICKS_PER_US);
+        
+        /*---------- Poll the busy flag until the command is finished ----------*/
+        do{
+            value = LCD_read_byte(0);
+            ticks[i] = (uint16_t)(LCD_TIMER - start);
+            if(ticks[i] > LCD_BUSY_TICKS_MAX) return;  //(No answer, keep the worst case delays)
+        }while(value & 0b10000000);
+        
+        /* A wrong address means the pins aren't read properly(e.g. "R/W" not connected) */
+        if( (value & 0b01111111) != address[i] ) return;
+    }
+    
+    /*---------- Add the margin(never go above the worst case delays) ----------*/
+    if(ticks[1] > ticks[0]) ticks[0] = ticks[1];  //(Short delay covers both the commands and the data writes)
+    delay = ( (uint32_t)ticks[0] * (100 + LCD_CALIBRATE_MARGIN) / 100 + LCD_TIMER_TICKS_PER_US - 1 ) / LCD_TIMER_TICKS_PER_US;
+    if(delay < LCD_BUSY_DELAY) LCD_busy_short = (uint16_t)delay;
+    
+    delay = ( (uint32_t)ticks[2] * (100 + LCD_CALIBRATE_MARGIN) / 100 + LCD_TIMER_TICKS_PER_US - 1 ) / LCD_TIMER_TICKS_PER_US;
+    if(delay > LCD_busy_short && delay < LCD_BUSY_DELAY + LCD_BUSY_DELAY_EXTENDED) LCD_busy_long = (uint16_t)(delay - LCD_busy_short);
+}
+
+#endif
\ No newline at end of file
@@ -34,9 +34,9 @@ void LCD_clear(){
     /* Send the clear command(automatically sets cursor to 1,1) */
     LCD_write_command(LCD_CMD_CLEAR);
     
-    /* Give the extended delay needed by the longer command */
-    __delay_us(LCD_BUSY_DELAY_EXTENDED);
+    /* Give(or record) the extended delay needed by the longer command */
+    LCD_BUSY_EXTEND(LCD_BUSY_LONG);
     
-    /* Re-send the entry mode, otherwise clear command resets the id to increment */
-    LCD_write_command(LCD_entry_mode);
+    /* Re-send the entry mode if it's decrement, otherwise clear command resets the id to increment */
+    if( !(LCD_mode & 0b00010000) ) LCD_write_command(LCD_ENTRY_MODE);
 }
\ No newline at end of file
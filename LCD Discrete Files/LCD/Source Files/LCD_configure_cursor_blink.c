@@ -32,14 +32,14 @@
  */
 void LCD_configure_cursor_blink(uint8_t state){
     
-    /* Change the gobal display control variable accordingly */
+    /* Change the display control bits of the gobal mode variable accordingly */
     if(state){
-        LCD_display_control |= 0b00000001;
+        LCD_mode |= 0b00000001;
     }
     else{
-        LCD_display_control &= 0b11111110;
+        LCD_mode &= 0b11111110;
     }
     
     /* Send the new display control command */
-    LCD_write_command(LCD_display_control);
+    LCD_write_command(LCD_DISPLAY_CONTROL);
 }
\ No newline at end of file
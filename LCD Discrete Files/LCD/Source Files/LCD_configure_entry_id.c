@@ -32,14 +32,14 @@
  */
 void LCD_configure_entry_id(uint8_t state){
     
-    /* Change the gobal entry mode variable accordingly */
+    /* Change the entry mode bits of the gobal mode variable accordingly */
     if(state){
-        LCD_entry_mode |= 0b00000010;
+        LCD_mode |= 0b00010000;
     }
     else{
-        LCD_entry_mode &= 0b11111101;
+        LCD_mode &= 0b11101111;
     }
     
     /* Send the new entry mode command */
-    LCD_write_command(LCD_entry_mode);
+    LCD_write_command(LCD_ENTRY_MODE);
 }
\ No newline at end of file
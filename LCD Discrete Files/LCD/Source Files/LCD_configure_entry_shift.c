@@ -33,14 +33,14 @@
  */
 void LCD_configure_entry_shift(uint8_t state){
     
-    /* Change the gobal entry mode variable accordingly */
+    /* Change the entry mode bits of the gobal mode variable accordingly */
     if(state){
-        LCD_entry_mode |= 0b00000001;
+        LCD_mode |= 0b00001000;
     }
     else{
-        LCD_entry_mode &= 0b11111110;
+        LCD_mode &= 0b11110111;
     }
     
     /* Send the new entry mode command */
-    LCD_write_command(LCD_entry_mode);
+    LCD_write_command(LCD_ENTRY_MODE);
 }
\ No newline at end of file
@@ -0,0 +1,46 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+/**
+ * Converts an unsigned variable to decimal digits\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param *end: Pointer right after the last character of the
+ * buffer(digits are placed from right to left, max. 10 digits)
+ * @param variable: Variable to be converted
+ * @return Pointer to the first(most significant) digit
+ */
+char* LCD_convert_digits(char *end, uint32_t variable){
+    
+    /* Place the digits from right to left(do-while since even 0 has 1 digit) */
+    do{
+        *--end = (char)(variable%10) + '0';  //Place the digit(with character 0 as offset)
+        variable /= 10;                      //Shift the number to the right
+    }while(variable);
+    
+    return end;
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_QUEUE_SIZE > 0
+
+/**
+ * Writes the characters queued with "LCD_post_char"/"LCD_post_string"
+ * (has to be called periodically by the main code, e.g. from the main loop)\n
+ * (The cursor location is only set when the next character isn't right
+ * after the previous one)\n
+ * (Only the characters queued before the call are written, so an
+ * interrupt that keeps posting can't keep it busy forever)\n
+ * (The characters go from left to right whatever the entry mode is, the
+ * entry mode and the cursor location are restored afterwards)
+ * @return Number of characters written
+ */
+uint8_t LCD_drain(){
+    
+    uint8_t count = 0;             //Number of characters written
+    uint8_t address = 0;           //DDRAM address of the next character(0 is never a set address command)
+    uint8_t cursor = LCD_address;  //Cursor location to be restored
+    uint8_t head = LCD_queue_head; //Last entry to be written(the ones posted after this wait for the next call)
+    
+    /* Nothing to write(or to restore) */
+    if(LCD_queue_tail == head) return 0;
+    
+    /* Increment without display shift, "address" below counts upwards */
+    uint8_t mode = LCD_entry_forward();
+    
+    /* Write the entries until the tail reaches the head(only this function changes the tail) */
+    while(LCD_queue_tail != head){
+        
+        uint8_t tail = LCD_queue_tail & (LCD_QUEUE_SIZE-1);
+        
+        /* Set the cursor location only if it's not where the previous character left it */
+        if(LCD_queue_address[tail] != address){
+            address = LCD_queue_address[tail];
+            LCD_write_command(address);
+        }
+        LCD_RS_LAT = 1;                                //(Not "LCD_write_data", it would call "LCD_preempt")
+#if LCD_USE_BATCH
+        if( !LCD_batch_open || !LCD_batch_data(LCD_queue_character[tail]) )
+#endif
+        LCD_write_byte(LCD_queue_character[tail]);
+        LCD_address_step(LCD_mode & 0b00010000);
+        address++;
+        count++;
+        
+        /* Free the entry after it's used(single byte write) */
+        LCD_queue_tail++;
+    }
+    
+    /* Restore the entry mode and the cursor location */
+    LCD_entry_restore(mode);
+    LCD_write_command(LCD_CMD_DDRAM_SET | cursor);
+    
+    return count;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,48 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "LCD.h"
+
+
+/**
+ * Sets the entry mode to increment without display shift(if it isn't
+ * already) for the writes that have to go from left to right no matter
+ * how the entry mode is configured(CGRAM patterns, frame runs, fields...)\n
+ * (Has to be followed by "LCD_entry_restore" with the returned value)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @return Mode bits to be restored
+ */
+uint8_t LCD_entry_forward(){
+    
+    uint8_t mode = LCD_mode;
+    
+    if((mode & 0b00011000) != 0b00010000){
+        LCD_mode = (mode & 0b11100111) | 0b00010000;  //(Tracked address follows the new mode too)
+        LCD_write_command(LCD_ENTRY_MODE);
+    }
+    
+    return mode;
+}
\ No newline at end of file
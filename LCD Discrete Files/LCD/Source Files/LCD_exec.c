@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_EXEC
+
+/**
+ * Runs a screen program(bytecode), e.g. a whole static screen with its
+ * custom characters, in one call\n
+ * (A program is a list of "LCD_OP_..." opcodes(see "LCD.h"), each
+ * followed by its operands, that ends with "LCD_OP_END")\n
+ * (Declare the program as "const" to keep it in program memory
+ * instead of RAM)\n
+ * (The characters are written from left to right whatever the entry mode
+ * is, the entry bits of "LCD_OP_CONFIG" take effect after the program)\n
+ * <u>Example:</u>\n
+ * const uint8_t screen[] = { LCD_OP_CLEAR, LCD_OP_WRITE, 5, 'T','e','m','p',':',\n
+ *                            LCD_OP_ADDRESS, LCD_AT(2,1), LCD_OP_VALUE, 0, 6, 1, LCD_OP_END };\n
+ * LCD_exec(screen, values);
+ * @param *program: Bytecode to be run
+ * @param *values: Live values written by "LCD_OP_VALUE"(fixed-point, can
+ * be NULL if the program doesn't have any)
+ */
+void LCD_exec(const uint8_t *program, const int32_t *values){
+    
+    char text[12];    //Characters of a value(max. '-', 10 digits and '.')
+    uint8_t opcode;   //Current opcode
+    uint8_t count;    //Number of characters of the current opcode
+    uint8_t mode;     //Mode to be left at the end(the addresses in the program count upwards)
+    
+    mode = LCD_entry_forward();
+    
+    while(1){
+        
+        opcode = *program++;
+        
+        if(opcode == LCD_OP_ADDRESS){                              //Set the cursor
+            LCD_write_command(LCD_CMD_DDRAM_SET | *program++);
+        }
+        else if(opcode == LCD_OP_WRITE){                           //Write the characters that follow
+            count = *program++;
+            LCD_write_buffer((const char*)program, count);
+            program += count;
+        }
+        else if(opcode == LCD_OP_FILL){                            //Write the same character "count" times
+            count = *program++;
+            while(count--) LCD_write_data((char)*program);
+            program++;
+        }
+        else if(opcode == LCD_OP_GLYPH){                           //Change a custom character
+            LCD_set_character((const char*)program + 1, *program);
+            program += 9;
+        }
+        else if(opcode == LCD_OP_CONFIG){                          //Set the display bits(entry bits at the end)
+            mode = *program++;
+            LCD_mode = (mode & 0b11100111) | 0b00010000;
+            LCD_write_command(LCD_DISPLAY_CONTROL);
+        }
+        else if(opcode == LCD_OP_CLEAR){                           //Clear the screen
+            LCD_clear();
+        }
+        else if(opcode == LCD_OP_VALUE){                           //Write a live value
+            count = program[1];
+            if(count > sizeof(text)) count = sizeof(text);
+            LCD_format_fixed(text, count, program[2], values[program[0]]);
+            LCD_write_buffer(text, count);
+            program += 3;
+        }
+        else{                                                      //LCD_OP_END(or an unknown opcode)
+            LCD_entry_restore(mode);
+            return;
+        }
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_FIELD_COUNT > 0
+
+/* Initialize the global variables */
+uint8_t LCD_field_row[LCD_FIELD_COUNT];                   //Row of each field
+uint8_t LCD_field_column[LCD_FIELD_COUNT];                //Column of each field
+uint8_t LCD_field_width[LCD_FIELD_COUNT];                 //Width of each field
+uint8_t LCD_field_f_digit[LCD_FIELD_COUNT];               //Fractional digits of each field
+char    LCD_field_text[LCD_FIELD_COUNT][LCD_FIELD_WIDTH];  //Last rendered characters of each field
+
+
+/**
+ * Declares a display field that shows a (fixed-point) number at a fixed
+ * location\n
+ * (The field is repainted with "LCD_field_set", only the characters
+ * that changed since the last call are sent to the LCD)\n
+ * (Max. "LCD_FIELD_COUNT" fields can be declared at a time)
+ * @param id: Field number(0 to LCD_FIELD_COUNT-1)
+ * @param row: Row position of the field(1-4)
+ * @param column: Column position of the field's first character(1-20)
+ * @param width: Width of the field in characters(max. LCD_FIELD_WIDTH)\n
+ * (The number is written right aligned inside the field)
+ * @param f_digit: How many digits of the value are fractional\n
+ * (e.g. with 1, value 234 will be shown as "23.4")
+ */
+void LCD_field_add(uint8_t id, uint8_t row, uint8_t column, uint8_t width, uint8_t f_digit){
+    
+    /* Limit the width to the space reserved for each field */
+    if(width > LCD_FIELD_WIDTH) width = LCD_FIELD_WIDTH;
+    
+    /* Save the field's format */
+    LCD_field_row[id]     = row;
+    LCD_field_column[id]  = column;
+    LCD_field_width[id]   = width;
+    LCD_field_f_digit[id] = f_digit;
+    
+    /* Forget the last rendered characters so the first "LCD_field_set" paints the whole field.
+     * (0 is never rendered by a field, so every character will be different.) */
+    for(uint8_t i=0 ; i < LCD_FIELD_WIDTH ; i++){
+        LCD_field_text[id][i] = 0;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_FIELD_COUNT > 0
+
+/**
+ * Shows a new value on a display field declared with "LCD_field_add"\n
+ * (Only the characters that differ from the last shown value are
+ * written, e.g. 23.4 -> 23.5 costs 1 cursor set and 1 character)\n
+ * (If the value doesn't fit, the field is filled with '*')\n
+ * (Cursor will point to the right side of the last changed character)
+ * @param id: Field number(0 to LCD_FIELD_COUNT-1)
+ * @param value: Value to be shown(fixed-point, scaled by the field's f_digit)
+ */
+void LCD_field_set(uint8_t id, int32_t value){
+    
+    char text[LCD_FIELD_WIDTH];  //New characters of the field
+    uint8_t width = LCD_field_width[id];
+    uint8_t mode  = LCD_mode;    //Entry mode to be restored
+    
+    /*---------- Render the value right aligned(or '*' if it doesn't fit) ----------*/
+    LCD_format_fixed(text, width, LCD_field_f_digit[id], value);
+    
+    /*---------- Write only the runs of characters that changed ----------*/
+    for(uint8_t i=0 ; i < width ; i++){
+        
+        if(text[i] == LCD_field_text[id][i]) continue;  //Skip the unchanged characters
+        
+        uint8_t start = i;                              //Find the end of the changed run
+        while(i < width && text[i] != LCD_field_text[id][i]){
+            LCD_field_text[id][i] = text[i];            //Remember the new character
+            i++;
+        }
+        
+        if(mode == LCD_mode) mode = LCD_entry_forward();  //(Runs are written from left to right)
+        LCD_cursor_set(LCD_field_row[id], LCD_field_column[id] + start);
+        LCD_write_buffer(text + start, i - start);
+    }
+    LCD_entry_restore(mode);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,83 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_EXEC || LCD_FIELD_COUNT > 0
+
+/**
+ * Renders a (fixed-point) number right aligned into a number of
+ * characters, shared by the field and bytecode functions\n
+ * (If the value doesn't fit, the characters are filled with '*')\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param *text: Characters to be filled(not null terminated)
+ * @param width: Number of characters
+ * @param f_digit: How many digits of the value are fractional\n
+ * (e.g. with 1, value 234 will be rendered as "23.4")
+ * @param value: Value to be rendered
+ */
+void LCD_format_fixed(char *text, uint8_t width, uint8_t f_digit, int32_t value){
+    
+    char buffer[10];   //Buffer to hold the digits(max. 10 digits for 32-bit)
+    char *digits;      //Pointer to the first digit in the buffer
+    uint8_t count;     //Variable to hold the number of digits
+    uint8_t length;    //Total number of characters of the value
+    uint8_t position;  //Position to place the next character(from right to left)
+    
+    /*----- Turn negative numbers into positive(unsigned, so -2147483648 fits too) -----*/
+    uint32_t magnitude = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+    
+    /*---------- Convert the value into digits ----------*/
+    digits = LCD_convert_digits(buffer + sizeof(buffer), magnitude);
+    count  = (uint8_t)((buffer + sizeof(buffer)) - digits);
+    
+    /*---------- Calculate the total length(digits, leading '0' of "0.x", '.' and '-') ----------*/
+    length = count;
+    if(f_digit){
+        if(length <= f_digit) length = f_digit + 1;
+        length++;
+    }
+    if(value < 0) length++;
+    
+    /*---------- Render the value right aligned(or '*' if it doesn't fit) ----------*/
+    position = width;
+    if(length > width){
+        while(position) text[--position] = '*';
+    }
+    else{
+        for(uint8_t i=0 ; i < f_digit ; i++){                  //Place the fractional digits
+            text[--position] = count ? digits[--count] : '0';  //(with leading zeros if needed)
+        }
+        if(f_digit) text[--position] = '.';                    //Place the '.' character
+        do{                                                    //Place the integer digits
+            text[--position] = count ? digits[--count] : '0';  //(at least one digit)
+        }while(count);
+        if(value < 0) text[--position] = '-';                  //Place the sign
+        while(position) text[--position] = ' ';                //Fill the rest with empty spaces
+    }
+}
+
+#endif
\ No newline at end of file
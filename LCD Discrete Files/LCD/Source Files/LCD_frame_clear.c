@@ -0,0 +1,57 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_FRAME_RATE > 0
+
+/* Initialize the global variables */
+char    LCD_frame_buffer[LCD_ROWS][LCD_COLUMNS];           //Characters of the frame
+uint8_t LCD_frame_dirty[LCD_ROWS][LCD_FRAME_DIRTY_BYTES];  //1 bit per cell, set if the cell changed
+
+
+/**
+ * Clears the frame(and the whole screen) and resets cursor to 1,1\n
+ * (Has to be called once after "LCD_init" before using the other frame
+ * functions)
+ */
+void LCD_frame_clear(){
+    
+    /* Fill the frame with empty spaces and mark every cell as up to date */
+    for(uint8_t row=0 ; row < LCD_ROWS ; row++){
+        for(uint8_t column=0 ; column < LCD_COLUMNS ; column++){
+            LCD_frame_buffer[row][column] = ' ';
+        }
+        for(uint8_t i=0 ; i < LCD_FRAME_DIRTY_BYTES ; i++){
+            LCD_frame_dirty[row][i] = 0;
+        }
+    }
+    
+    /* Clear the screen to match the frame */
+    LCD_clear();
+}
+
+#endif
\ No newline at end of file
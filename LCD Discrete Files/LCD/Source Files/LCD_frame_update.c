@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_FRAME_RATE > 0
+
+/**
+ * Sends the changed cells of the frame to the LCD if the frame period
+ * has passed(has to be called periodically, e.g. from the main loop)\n
+ * (At most one update per frame period, so the time spent on the LCD
+ * is limited no matter how often the frame is written)\n
+ * (Each run of changed cells costs 1 cursor set, then 1 byte per cell)
+ * @return 1 if the frame was due and sent, 0 otherwise
+ */
+uint8_t LCD_frame_update(){
+    
+    uint8_t mode = LCD_mode;  //Entry mode to be restored
+    
+    /* Do nothing until the frame period passes */
+    if(!LCD_frame_due) return 0;
+    LCD_frame_due = 0;
+    
+    for(uint8_t row=0 ; row < LCD_ROWS ; row++){
+        for(uint8_t column=0 ; column < LCD_COLUMNS ; column++){
+            
+            /* Skip the clean cells */
+            if( !(LCD_frame_dirty[row][column >> 3] & (1 << (column & 7))) ) continue;
+            
+            /* Find the end of the run of changed cells, clearing their marks */
+            uint8_t start = column;
+            while( column < LCD_COLUMNS && (LCD_frame_dirty[row][column >> 3] & (1 << (column & 7))) ){
+                LCD_frame_dirty[row][column >> 3] &= (uint8_t)~(1 << (column & 7));
+                column++;
+            }
+            
+            /* Write the whole run at once(from left to right, see "LCD_entry_forward") */
+            if(mode == LCD_mode) mode = LCD_entry_forward();
+            LCD_cursor_set(row + 1, start + 1);
+            LCD_write_buffer(&LCD_frame_buffer[row][start], column - start);
+        }
+    }
+    LCD_entry_restore(mode);
+    
+    return 1;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_FRAME_RATE > 0
+
+/**
+ * Writes a string to the given location of the frame\n
+ * (Nothing is sent to the LCD, the string is shown on the next
+ * "LCD_frame_update" after the frame period, writing the same cells
+ * again before then simply overwrites them)\n
+ * (Characters past the end of the row are ignored)\n
+ * <STRONG>!!!The string has to be null terminated otherwise this function will fail or loop forever!!!</STRONG>
+ * @param row: Row position(1-4)
+ * @param column: Column position(1-20)
+ * @param *string: Character array that contains the string
+ */
+void LCD_frame_write_string(uint8_t row, uint8_t column, const char *string){
+    
+    /* Write all characters one by one until you reach "NULL" or the end of the row */
+    while(*string != '\0' && column <= LCD_COLUMNS){
+        LCD_frame_write_char(row, column++, *string++);
+    }
+}
+
+#endif
\ No newline at end of file
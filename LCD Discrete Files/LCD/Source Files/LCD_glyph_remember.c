@@ -0,0 +1,53 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_RW && LCD_FRAME_RATE > 0
+
+/* Initialize the global variables */
+char    LCD_glyph_pattern[8][8];  //Copy of the pattern of each custom character
+uint8_t LCD_glyph_loaded;         //Bit of each custom character that has a pattern in "LCD_glyph_pattern"
+
+
+/**
+ * Keeps a copy of the pattern of a custom character, so "LCD_verify" and
+ * "LCD_resync" can check and rewrite it even if the caller's pattern is
+ * gone(e.g. a buffer on the stack)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param *pattern: Binary pattern of the character
+ * @param address: CGRAM location of the character(0-7)
+ */
+void LCD_glyph_remember(const char *pattern, uint8_t address){
+    
+    for(uint8_t i=0 ; i < 8 ; i++){
+        LCD_glyph_pattern[address][i] = pattern[i];
+    }
+    LCD_glyph_loaded |= (uint8_t)(1 << address);
+}
+
+#endif
\ No newline at end of file
@@ -27,8 +27,7 @@
 
 
 /* Initialize the global variables */
-uint8_t LCD_display_control = LCD_CMD_DISPLAY_CONTROL;
-uint8_t LCD_entry_mode      = LCD_CMD_ENTRY_MODE;
+uint8_t LCD_mode = LCD_MODE_DEFAULT;  //Display control and entry mode bits packed in one byte
 
 
 /**
@@ -49,41 +48,21 @@ void LCD_init(){
     LCD_D5_TRIS = 0; LCD_D5_LAT = 0;
     LCD_D6_TRIS = 0; LCD_D6_LAT = 0;
     LCD_D7_TRIS = 0; LCD_D7_LAT = 0;
+#if LCD_USE_RW
+    LCD_RW_TRIS = 0; LCD_RW_LAT = 0;
+#endif
     
-    //******************************************************************//
-    //*** Sequence for "Initializing 4-bit interface" from datasheet ***//
-    //******************************************************************//
-    
-    //---------- Wait for more than 40ms ----------
+    //---------- Wait for more than 40ms(power-up) ----------
     __delay_ms(60);
     
-    //---------- Load 0b0011 in command mode ----------
-    LCD_D7_LAT = 0; LCD_D6_LAT = 0; LCD_D5_LAT = 1; LCD_D4_LAT = 1;
-    
-    //---------- Send a clock pulse ----------
-    LCD_pulse_clock();
-    
-    //---------- Wait for more than 4.1ms ----------
-    __delay_ms(6);
-    
-    //---------- Send a clock pulse ----------
-    LCD_pulse_clock();
-    
-    //---------- Wait for more than 100us ----------
-    __delay_us(150);
-    
-    //---------- Send a clock pulse ----------
-    LCD_pulse_clock();
-    
-    //---------- Load 0b0010 in command mode(4-bit mode start) ----------
-    LCD_D7_LAT = 0; LCD_D6_LAT = 0; LCD_D5_LAT = 1; LCD_D4_LAT = 0;
+    //---------- Switch to 4-bit mode and configure important settings ----------
+    LCD_sync();
     
-    //---------- Send a clock pulse ----------
-    LCD_pulse_clock();
+#if LCD_CALIBRATE && LCD_USE_RW && LCD_USE_TIMER
+    //---------- Measure the delays of the LCD ----------
+    LCD_calibrate();
     
-    //---------- Configure important settings ----------
-    LCD_write_command(LCD_CMD_FUNCTION_SET);  //Function Set(4-bit, 2 line, 5x8 dots)
-    LCD_write_command(LCD_display_control);   //Display On/Off Control(Display on, cursor off, blinking off)
-    LCD_write_command(LCD_entry_mode);        //Entry Mode Set(Increment, shift off)
-    LCD_clear();                              //Clear the display
+#endif
+    //---------- Clear the display ----------
+    LCD_clear();
  }
\ No newline at end of file
@@ -0,0 +1,54 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_PAGES
+
+/**
+ * Clears a page without touching the others(e.g. before writing a page
+ * that is not on the screen)\n
+ * (Cursor will point to the right side of the page's last row)
+ * @param page: Page to be cleared(0 to LCD_PAGE_COUNT-1)
+ */
+void LCD_page_clear(uint8_t page){
+    
+    char spaces[LCD_COLUMNS];  //A row of empty characters
+    
+    for(uint8_t i=0 ; i < LCD_COLUMNS ; i++){
+        spaces[i] = ' ';
+    }
+    
+    /* Overwrite each row of the page(from left to right, see "LCD_entry_forward") */
+    uint8_t mode = LCD_entry_forward();
+    for(uint8_t row=1 ; row <= LCD_ROWS ; row++){
+        LCD_page_cursor_set(page, row, 1);
+        LCD_write_buffer(spaces, LCD_COLUMNS);
+    }
+    LCD_entry_restore(mode);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,48 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_PAGES
+
+/**
+ * Sets the cursor to a location on a page, the page can be written
+ * while another page is on the screen\n
+ * (Each line of the LCD holds 40 characters, the ones that don't fit
+ * on the screen are used as "LCD_PAGE_COUNT" pages)\n
+ * <STRONG>Note: Writing past the last column of a page continues on
+ * the next page or line!</STRONG>
+ * @param page: Page to be written(0 to LCD_PAGE_COUNT-1)
+ * @param row: Row position of the cursor(1-2)
+ * @param column: Column position of the cursor(1 to LCD_COLUMNS)
+ */
+void LCD_page_cursor_set(uint8_t page, uint8_t row, uint8_t column){
+    
+    /* Pages are placed one after the other on the same lines */
+    LCD_cursor_set(row, column + page*LCD_COLUMNS);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,57 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_PAGES
+
+/**
+ * Shows a page by shifting the display to it, the characters are
+ * already in the LCD so the switch is instant\n
+ * (Takes max. 20 shift commands, much less than clearing and
+ * rewriting the screen)\n
+ * (Pages are kept track of through the shift commands, "LCD_clear" and
+ * "LCD_shift_reset" go back to page 0. Don't use with the entry shift
+ * on, see "LCD_configure_entry_shift")
+ * @param page: Page to be shown(0 to LCD_PAGE_COUNT-1)
+ */
+void LCD_page_flip(uint8_t page){
+    
+    /* Find how many characters the display needs to move to the left */
+    uint8_t target = page * LCD_COLUMNS;
+    uint8_t steps  = (target >= LCD_shift) ? (target - LCD_shift) : (target + 40 - LCD_shift);
+    
+    /* Shift to the closer side(the line wraps around after 40 characters) */
+    if(steps <= 20){
+        while(steps--) LCD_write_command(LCD_CMD_SHIFT_LEFT);
+    }
+    else{
+        steps = 40 - steps;
+        while(steps--) LCD_write_command(LCD_CMD_SHIFT_RIGHT);
+    }
+}
+
+#endif
\ No newline at end of file
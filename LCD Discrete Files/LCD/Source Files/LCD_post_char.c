@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_QUEUE_SIZE > 0
+
+/* Initialize the global variables */
+volatile uint8_t LCD_queue_address[LCD_QUEUE_SIZE];    //DDRAM address(set command) of each queued character
+volatile char    LCD_queue_character[LCD_QUEUE_SIZE];  //Queued characters
+volatile uint8_t LCD_queue_head;                       //Number of queued characters(changed only by the poster)
+volatile uint8_t LCD_queue_tail;                       //Number of written characters(changed only by "LCD_drain")
+
+
+/**
+ * Queues an ASCII character to be written at the given location, safe
+ * to call from an interrupt while the main code is using the LCD\n
+ * (Nothing is sent to the LCD, the main code sends the queued characters
+ * with "LCD_drain", interrupts are never disabled)\n
+ * (With LCD_QUEUE_URGENT they are also sent between the characters of
+ * any write the main code is doing, so they don't wait for it to end)\n
+ * <STRONG>Only one interrupt(or one context) may post, and only the main
+ * code may drain!</STRONG>
+ * @param row: Row position(1-4)
+ * @param column: Column position(1-20)
+ * @param character: Character to be written
+ * @return 1 if the character was queued, 0 if the queue was full
+ */
+uint8_t LCD_post_char(uint8_t row, uint8_t column, char character){
+    
+    uint8_t head = LCD_queue_head;  //Only this function changes the head
+    
+    /* If the queue is full, give up */
+    if( (uint8_t)(head - LCD_queue_tail) >= LCD_QUEUE_SIZE ) return 0;
+    
+    /* Offset the column address with the corresponding row */
+    if(row == 1) column += LCD_CMD_DDRAM_LINE_1;
+    if(row == 2) column += LCD_CMD_DDRAM_LINE_2;
+    if(row == 3) column += LCD_CMD_DDRAM_LINE_3;
+    if(row == 4) column += LCD_CMD_DDRAM_LINE_4;
+    
+    /* Fill the entry first, then publish it by moving the head(single byte write) */
+    LCD_queue_address[head & (LCD_QUEUE_SIZE-1)]   = column;
+    LCD_queue_character[head & (LCD_QUEUE_SIZE-1)] = character;
+    LCD_queue_head = head + 1;
+    
+    return 1;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,55 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_QUEUE_SIZE > 0
+
+/**
+ * Queues a string to be written at the given location, safe to call
+ * from an interrupt while the main code is using the LCD\n
+ * (See "LCD_post_char")\n
+ * <STRONG>!!!The string has to be null terminated otherwise this function will fail or loop forever!!!</STRONG>
+ * @param row: Row position(1-4)
+ * @param column: Column position(1-20)
+ * @param *string: Character array that contains the string
+ * @return Number of characters queued(less than the string length if
+ * the queue got full)
+ */
+uint8_t LCD_post_string(uint8_t row, uint8_t column, const char *string){
+    
+    uint8_t count = 0;  //Number of characters queued
+    
+    /* Queue all characters one by one until you reach "NULL" or the queue is full */
+    while(string[count] != '\0'){
+        if( !LCD_post_char(row, column + count, string[count]) ) break;
+        count++;
+    }
+    
+    return count;
+}
+
+#endif
\ No newline at end of file
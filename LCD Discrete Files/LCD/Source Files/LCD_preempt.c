@@ -0,0 +1,50 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_QUEUE_SIZE > 0 && LCD_QUEUE_URGENT
+
+/**
+ * Sends the characters queued with "LCD_post_char"/"LCD_post_string" in
+ * the middle of a longer write, then puts the entry mode and the cursor
+ * back so the interrupted write continues from where it was\n
+ * (Called between the characters of every write when the queue isn't
+ * empty, does nothing while the cursor is in CGRAM)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ */
+void LCD_preempt(){
+    
+    /* Custom characters can't be interrupted(the cursor can't be put back into CGRAM) */
+    if(LCD_cgram) return;
+    
+    /* Send the queued characters("LCD_drain" restores the entry mode and the address of the interrupted write) */
+    LCD_drain();
+    
+    LCD_RS_LAT = 1; //Back to data mode for the rest of the interrupted write
+}
+
+#endif
\ No newline at end of file
@@ -32,7 +32,11 @@
  */
 void LCD_pulse_clock(){
   
-  LCD_EN_LAT = 1;              //Set the "EN" pin
-  __delay_us(LCD_BUSY_DELAY);  //Give the required delay
-  LCD_EN_LAT = 0;              //Clear the "EN" pin
+  LCD_EN_LAT = 1;  //Set the "EN" pin
+  __delay_us(1);   //Give the required pulse width
+  LCD_EN_LAT = 0;  //Clear the "EN" pin
+  
+#if LCD_TRACE_SIZE > 0
+  LCD_trace_record( (uint8_t)((LCD_RS_LAT << 4) | (LCD_D7_LAT << 3) | (LCD_D6_LAT << 2) | (LCD_D5_LAT << 1) | LCD_D4_LAT) );
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,88 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_RW
+
+/**
+ * Reads an 8-bit data or the busy flag and address (in 4-bit mode)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param rs: 1 to read data from the current address, 0 to read the
+ * busy flag(bit 7) and the current address(bits 0-6)
+ * @return 8-bit value read from the LCD
+ */
+uint8_t LCD_read_byte(uint8_t rs){
+    
+    uint8_t value;  //Variable to hold the value read
+    
+#if LCD_USE_BATCH
+    /* Bring the LCD up to date first(reading data moves the address without it being tracked) */
+    if(LCD_batch_open){
+        LCD_batch_flush();
+        if(rs) LCD_batch_lost = 1;
+    }
+#endif
+    
+    /* Reading data needs the previous command to be finished(the busy flag can be read anytime) */
+    if(rs){
+        LCD_BUSY_WAIT();
+    }
+    
+    /*---------- Turn the data pins into inputs and enter read mode ----------*/
+    LCD_D4_TRIS = 1; LCD_D5_TRIS = 1; LCD_D6_TRIS = 1; LCD_D7_TRIS = 1;
+    LCD_RS_LAT = rs;
+    LCD_RW_LAT = 1;
+    
+    /*---------- Read higher order 4-bits ----------*/
+    LCD_EN_LAT = 1;
+    __delay_us(1);
+    value = (uint8_t)( (LCD_D7_PORT << 7) | (LCD_D6_PORT << 6) | (LCD_D5_PORT << 5) | (LCD_D4_PORT << 4) );
+    LCD_EN_LAT = 0;
+    __delay_us(1);
+    
+    /*---------- Read lower order 4-bits ----------*/
+    LCD_EN_LAT = 1;
+    __delay_us(1);
+    value |= (uint8_t)( (LCD_D7_PORT << 3) | (LCD_D6_PORT << 2) | (LCD_D5_PORT << 1) | LCD_D4_PORT );
+    LCD_EN_LAT = 0;
+    
+#if LCD_TRACE_SIZE > 0
+    LCD_trace_record( (uint8_t)(0b00100000 | (rs << 4) | (value >> 4)) );
+    LCD_trace_record( (uint8_t)(0b00100000 | (rs << 4) | (value & 0b00001111)) );
+#endif
+    
+    /*---------- Go back to write mode and turn the data pins into outputs ----------*/
+    LCD_RW_LAT = 0;
+    LCD_D4_TRIS = 0; LCD_D5_TRIS = 0; LCD_D6_TRIS = 0; LCD_D7_TRIS = 0;
+    
+    /* Reading data moves the address just like writing, give(or record) the same delay */
+    if(rs) LCD_BUSY_SET(LCD_BUSY_SHORT);
+    
+    return value;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,84 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_RW && LCD_FRAME_RATE > 0
+
+/**
+ * Checks if the LCD still follows the library(it may lose the 4-bit mode
+ * after a supply dip or a glitch on "EN"), and brings it back if it
+ * doesn't without calling "LCD_init"\n
+ * (Should be called periodically, e.g. before "LCD_verify")\n
+ * (The custom characters added with "LCD_add_character" are sent again
+ * and the whole frame is redrawn by the next "LCD_frame_update")\n
+ * (Cursor location is restored after the check)
+ * @return 1 if the LCD had to be brought back, 0 if it was fine
+ */
+uint8_t LCD_resync(){
+    
+    uint8_t address = LCD_address;  //Cursor location to be restored
+    
+    /*---------- Move the cursor to the probe address and read it back ----------*/
+    LCD_write_command(LCD_CMD_DDRAM_SET | LCD_RESYNC_PROBE);
+    LCD_BUSY_WAIT();
+    if(LCD_read_byte(0) == LCD_RESYNC_PROBE){  //(Not busy and at the probe address)
+        LCD_write_command(LCD_CMD_DDRAM_SET | address);
+        return 0;
+    }
+    
+#if LCD_USE_BATCH
+    LCD_batch_entry = 0;  //(Entry mode of the LCD isn't known anymore)
+#endif
+    
+    /*---------- Get the 4-bit mode and the settings back ----------*/
+    LCD_sync();
+    
+    /*---------- Send the custom characters again ----------*/
+    uint8_t mode = LCD_entry_forward();
+    for(uint8_t location=0 ; location < 8 ; location++){
+        if(LCD_glyph_loaded & (1 << location)){
+            LCD_write_command( LCD_CMD_CGRAM_SET + (uint8_t)(location<<3) );
+            LCD_write_buffer(LCD_glyph_pattern[location], 8);
+        }
+    }
+    LCD_entry_restore(mode);
+    
+    /*---------- Mark the whole frame as changed(redrawn by the next "LCD_frame_update") ----------*/
+    for(uint8_t row=0 ; row < LCD_ROWS ; row++){
+        for(uint8_t i=0 ; i < LCD_FRAME_DIRTY_BYTES ; i++){
+            LCD_frame_dirty[row][i] = 0xFF;
+        }
+    }
+    LCD_frame_due = 1;
+    
+    /* Restore the cursor location */
+    LCD_write_command(LCD_CMD_DDRAM_SET | address);
+    
+    return 1;
+}
+
+#endif
\ No newline at end of file
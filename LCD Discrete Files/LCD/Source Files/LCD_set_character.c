@@ -0,0 +1,60 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_TRACK_ADDRESS
+
+/**
+ * Changes a custom character in the "CGRAM" without moving the cursor\n
+ * (Characters already on screen that use this location change too)\n
+ * (Character font needs to be 5x8!)
+ * @param *pattern: Binary pattern of the character\n
+ * (Declare the pattern as "const" to keep it in program memory
+ * instead of RAM, it can be changed or go out of scope after the call)
+ * @param location: CGRAM address to put the character(0-7)
+ */
+void LCD_set_character(const char *pattern, uint8_t address){
+    
+    /* Save the cursor location(writing the pattern moves the tracked address) */
+    uint8_t cursor = LCD_address;
+    
+    /* Set the CGRAM address and send the pattern(see "LCD_add_character") */
+    uint8_t mode = LCD_entry_forward();
+    LCD_write_command( LCD_CMD_CGRAM_SET + (uint8_t)(address<<3) );
+    LCD_write_buffer(pattern, 8);
+    
+#if LCD_USE_RW && LCD_FRAME_RATE > 0
+    /* Remember the pattern so "LCD_verify" can check it */
+    LCD_glyph_remember(pattern, address);
+#endif
+    
+    /* Point the cursor back from "CGRAM" to the saved "DDRAM" address */
+    LCD_entry_restore(mode);
+    LCD_write_command(LCD_CMD_DDRAM_SET | cursor);
+}
+
+#endif
\ No newline at end of file
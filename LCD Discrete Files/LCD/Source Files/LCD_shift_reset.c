@@ -34,6 +34,6 @@ void LCD_shift_reset(){
     /* Send the return home command(automatically sets cursor to 1,1) */
     LCD_write_command(LCD_CMD_RETURN_HOME);
     
-    /* Give the extended delay needed by the longer command */
-    __delay_us(LCD_BUSY_DELAY_EXTENDED);
+    /* Give(or record) the extended delay needed by the longer command */
+    LCD_BUSY_EXTEND(LCD_BUSY_LONG);
 }
\ No newline at end of file
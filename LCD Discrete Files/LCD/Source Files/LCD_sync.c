@@ -0,0 +1,80 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+/**
+ * Puts the LCD into 4-bit mode from any state(8-bit mode after power-up,
+ * or 4-bit mode with the nibbles out of step) and sends the settings\n
+ * (Display and entry mode are sent from the global mode variable, the
+ * screen and the cursor location are left as they are)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ */
+void LCD_sync(){
+    
+    //******************************************************************//
+    //*** Sequence for "Initializing 4-bit interface" from datasheet ***//
+    //******************************************************************//
+    
+    //---------- Wait for the previous command to finish ----------
+    LCD_BUSY_WAIT();
+    LCD_RS_LAT = 0;
+    
+    //---------- Load 0b0011 in command mode ----------
+    LCD_D7_LAT = 0; LCD_D6_LAT = 0; LCD_D5_LAT = 1; LCD_D4_LAT = 1;
+    
+    //---------- Send a clock pulse ----------
+    LCD_pulse_clock();
+    
+    //---------- Wait for more than 4.1ms ----------
+    __delay_ms(6);
+    
+    //---------- Send a clock pulse ----------
+    LCD_pulse_clock();
+    
+    //---------- Wait for more than 100us ----------
+    __delay_us(150);
+    
+    //---------- Send a clock pulse ----------
+    LCD_pulse_clock();
+    
+    //---------- Wait for the command to finish ----------
+    __delay_us(LCD_BUSY_DELAY);
+    
+    //---------- Load 0b0010 in command mode(4-bit mode start) ----------
+    LCD_D7_LAT = 0; LCD_D6_LAT = 0; LCD_D5_LAT = 1; LCD_D4_LAT = 0;
+    
+    //---------- Send a clock pulse ----------
+    LCD_pulse_clock();
+    
+    //---------- Give(or record) the delay of the command ----------
+    LCD_BUSY_SET(LCD_BUSY_SHORT);
+    
+    //---------- Configure important settings ----------
+    LCD_write_command(LCD_CMD_FUNCTION_SET);  //Function Set(4-bit, 2 line, 5x8 dots)
+    LCD_write_command(LCD_DISPLAY_CONTROL);   //Display On/Off Control(current display, cursor and blinking bits)
+    LCD_write_command(LCD_ENTRY_MODE);        //Entry Mode Set(current increment and shift bits)
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_FRAME_RATE > 0 || LCD_ANIM_COUNT > 0
+
+/* Initialize the global variables */
+uint16_t         LCD_frame_ticks;  //Ticks passed in the current frame period
+volatile uint8_t LCD_frame_due;    //Set when the frame period passes
+
+
+/**
+ * Time base of the library, has to be called periodically(e.g. from a
+ * timer interrupt) at "LCD_TICK_RATE" times per second\n
+ * (Only needed when the frame functions or the animations are used)
+ */
+void LCD_tick(){
+    
+#if LCD_FRAME_RATE > 0
+    /* Count the ticks of a frame period and mark the frame as due when it ends */
+    if(++LCD_frame_ticks >= (LCD_TICK_RATE / LCD_FRAME_RATE)){
+        LCD_frame_ticks = 0;
+        LCD_frame_due   = 1;
+    }
+#endif
+    
+#if LCD_ANIM_COUNT > 0
+    /* Count the ticks of each playing animation and mark its next frame as due when its period ends */
+    for(uint8_t i=0 ; i < LCD_ANIM_COUNT ; i++){
+        if(LCD_anim_frames[i] && ++LCD_anim_ticks[i] >= LCD_anim_period[i]){
+            LCD_anim_ticks[i] = 0;
+            LCD_anim_due[i]   = 1;
+        }
+    }
+#endif
+}
+
+#endif
\ No newline at end of file
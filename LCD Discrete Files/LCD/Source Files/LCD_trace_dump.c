@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_TRACE_SIZE > 0
+
+/**
+ * Sends the recorded bus events out one byte at a time(e.g. to a UART)
+ * and empties the trace\n
+ * (Can be turned into the screen, a VCD file and the bus usage on a PC
+ * with "LCD Tools/lcd_replay.c")\n
+ * (Timestamps are read from "LCD_TIMER", it needs to be running even
+ * if "LCD_USE_TIMER" is 0)\n
+ * <u>Format(little-endian):</u>\n
+ * "LCDT", version(1), timer ticks per uS(1), events lost(2, 65535 if more), event count(2),\n
+ * then for each event(oldest first): timer value(2), pins(1)
+ * @param put: Function that sends out a byte
+ */
+void LCD_trace_dump(void (*put)(char)){
+    
+    uint16_t count = LCD_trace_count;
+    uint16_t lost  = LCD_trace_lost;
+    
+    /*---------- Send the header ----------*/
+    put('L'); put('C'); put('D'); put('T');
+    put(1);
+    put(LCD_TIMER_TICKS_PER_US);
+    put((char)lost);  put((char)(lost >> 8));
+    put((char)count); put((char)(count >> 8));
+    
+    /*---------- Send the events from the oldest ----------*/
+    for(uint16_t i = LCD_trace_next - count ; count ; count--, i++){
+        uint16_t index = i & (LCD_TRACE_SIZE - 1);
+        put((char)LCD_trace_time[index]);
+        put((char)(LCD_trace_time[index] >> 8));
+        put((char)LCD_trace_event[index]);
+    }
+    
+    LCD_trace_count = 0;
+    LCD_trace_lost  = 0;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_TRACE_SIZE > 0
+
+/* Initialize the global variables */
+uint16_t LCD_trace_time[LCD_TRACE_SIZE];   //Timer value of each event("LCD_TIMER")
+uint8_t  LCD_trace_event[LCD_TRACE_SIZE];  //Pins of each event(bits 0-3: D4-D7, bit 4: RS, bit 5: RW)
+uint16_t LCD_trace_count;                  //Number of events in the trace(max. "LCD_TRACE_SIZE")
+uint16_t LCD_trace_next;                   //Index the next event goes to
+uint16_t LCD_trace_lost;                   //Events overwritten since the last dump(stops at 65535)
+
+
+/**
+ * Records a bus event(a nibble latched by the "EN" pin) into the trace\n
+ * (Oldest events are overwritten when the trace is full)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param event: Bits 0-3: D4-D7, bit 4: RS, bit 5: RW
+ */
+void LCD_trace_record(uint8_t event){
+    
+    LCD_trace_time[LCD_trace_next]  = LCD_TIMER;
+    LCD_trace_event[LCD_trace_next] = event;
+    LCD_trace_next = (LCD_trace_next + 1) & (LCD_TRACE_SIZE - 1);
+    
+    /* Count the event, or the overwritten one if the trace is full(without going back to 0) */
+    if(LCD_trace_count < LCD_TRACE_SIZE) LCD_trace_count++;
+    else if(LCD_trace_lost != 0xFFFF)    LCD_trace_lost++;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_UTF8 && LCD_UTF8_SLOTS > 0
+
+/* Initialize the global variables */
+const uint16_t *LCD_utf8_glyph_points;                 //Code points of the custom characters
+const char     *LCD_utf8_glyph_patterns;               //Patterns of the custom characters
+uint8_t         LCD_utf8_glyph_count;                  //Number of custom characters
+uint16_t        LCD_utf8_slot_points[LCD_UTF8_SLOTS];  //Code point loaded into each CGRAM location(0 if none)
+uint8_t         LCD_utf8_slot_next;                    //CGRAM location to be replaced next
+
+
+/**
+ * Gives the custom characters to be used by "LCD_write_utf8" for the
+ * characters that are missing in the LCD's ROM\n
+ * (Characters are loaded into the CGRAM only when they are written,
+ * using the last "LCD_UTF8_SLOTS" CGRAM locations in turns)
+ * @param *points: Unicode code points of the characters(e.g. 0x20AC for the euro sign)
+ * @param *patterns: Binary patterns of the characters, 8 bytes for each
+ * code point(see "LCD_add_character")
+ * @param count: Number of characters
+ */
+void LCD_utf8_glyphs(const uint16_t *points, const char *patterns, uint8_t count){
+    
+    /* Save the table */
+    LCD_utf8_glyph_points   = points;
+    LCD_utf8_glyph_patterns = patterns;
+    LCD_utf8_glyph_count    = count;
+    
+    /* Forget the characters loaded from the old table(0 is never a code point looked up here) */
+    for(uint8_t i=0 ; i < LCD_UTF8_SLOTS ; i++){
+        LCD_utf8_slot_points[i] = 0;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,116 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_RW && LCD_FRAME_RATE > 0
+
+/* Initialize the global variables */
+uint8_t LCD_verify_row;     //Row to be checked next(rows after the last row are custom characters)
+uint8_t LCD_verify_column;  //Column to be checked next
+
+
+/**
+ * Reads back a small part of the screen and the custom characters, and
+ * rewrites only the parts that don't match the frame(e.g. after
+ * electrical noise)\n
+ * (Has to be called periodically, e.g. from the main loop, each call
+ * checks "LCD_VERIFY_CHUNK" cells or 1 custom character, so the whole
+ * screen is checked in turns without blocking for long)\n
+ * (Cells waiting for the next "LCD_frame_update" are skipped)\n
+ * (Cursor location is restored after the check)\n
+ * <STRONG>Only works if the screen is written with the frame functions and
+ * the custom characters with "LCD_add_character"!</STRONG>
+ * @return Number of cells or custom characters that were repaired
+ */
+uint8_t LCD_verify(){
+    
+    uint8_t repaired = 0;  //Number of repaired cells/characters
+    
+    /* Remember the tracked address to restore it at the end(reading it back
+     * could catch the LCD still busy with the last command, before it moved) */
+    uint8_t address = LCD_address;
+    
+    /* Read the cells and the character rows from left to right/top to bottom */
+    uint8_t mode = LCD_entry_forward();
+    
+    if(LCD_verify_row < LCD_ROWS){
+        
+        /*---------- Check the next chunk of cells on the current row ----------*/
+        uint8_t row    = LCD_verify_row;
+        uint8_t column = LCD_verify_column;
+        LCD_cursor_set(row + 1, column + 1);
+        
+        for(uint8_t i=0 ; i < LCD_VERIFY_CHUNK && column < LCD_COLUMNS ; i++, column++){
+            
+            char actual = (char)LCD_read_byte(1);  //Read the cell(address moves to the next cell)
+            
+            /* Skip the cells that will be written anyway, repair the rest if they don't match */
+            if( LCD_frame_dirty[row][column >> 3] & (1 << (column & 7)) ) continue;
+            if( actual != LCD_frame_buffer[row][column] ){
+                LCD_cursor_set(row + 1, column + 1);
+                LCD_write_data(LCD_frame_buffer[row][column]);  //(Address moves to the next cell)
+                repaired++;
+            }
+        }
+        
+        /* Move onto the next chunk(next row after the end of the row) */
+        if(column == LCD_COLUMNS){
+            column = 0;
+            LCD_verify_row++;
+        }
+        LCD_verify_column = column;
+    }
+    else{
+        
+        /*---------- Check the next custom character ----------*/
+        uint8_t location = LCD_verify_row - LCD_ROWS;
+        const char *pattern = LCD_glyph_pattern[location];
+        
+        if(LCD_glyph_loaded & (1 << location)){
+            LCD_write_command( LCD_CMD_CGRAM_SET + (uint8_t)(location<<3) );
+            for(uint8_t i=0 ; i < 8 ; i++){
+                if( (LCD_read_byte(1) & 0b00011111) != (pattern[i] & 0b00011111) ){
+                    LCD_write_command( LCD_CMD_CGRAM_SET + (uint8_t)(location<<3) );  //Rewrite the whole character
+                    LCD_write_buffer(pattern, 8);
+                    repaired++;
+                    break;
+                }
+            }
+        }
+        
+        /* Move onto the next character(back to the first row after the last one) */
+        if(++LCD_verify_row == LCD_ROWS + 8) LCD_verify_row = 0;
+    }
+    
+    /* Restore the entry mode and the cursor location */
+    LCD_entry_restore(mode);
+    LCD_write_command(LCD_CMD_DDRAM_SET | address);
+    
+    return repaired;
+}
+
+#endif
\ No newline at end of file
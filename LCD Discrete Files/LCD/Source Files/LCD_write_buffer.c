@@ -0,0 +1,55 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+/**
+ * Writes a number of characters to the current cursor location\n
+ * (The data mode is entered only once for the whole buffer, so
+ * this is the fastest way of writing multiple characters)\n
+ * (The buffer doesn't have to be null terminated)
+ * @param *buffer: Character array that contains the characters
+ * @param length: Number of characters to be written
+ */
+void LCD_write_buffer(const char *buffer, uint16_t length){
+    
+    LCD_RS_LAT = 1; //Enter data mode(once for all the characters)
+    
+    /* Send all characters one by one(keeping track of the address, letting the queued characters through) */
+    while(length--){
+#if LCD_USE_BATCH
+        if( !LCD_batch_open || !LCD_batch_data(*buffer) )
+#endif
+        LCD_write_byte(*buffer);
+        buffer++;
+#if LCD_TRACK_ADDRESS
+        LCD_address_step(LCD_mode & 0b00010000);
+#endif
+#if LCD_QUEUE_SIZE > 0 && LCD_QUEUE_URGENT
+        if(LCD_queue_tail != LCD_queue_head) LCD_preempt();
+#endif
+    }
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_TIMER
+/* Initialize the global variables */
+uint16_t LCD_ready_at;  //Timer value when the LCD will finish the last command
+#endif
+
+
+/**
+ * Sends an 8-bit value (in 4-bit mode) without changing the "RS" pin,
+ * shared by the command and data functions\n
+ * (Waits until the LCD finishes the previous command first, the delay
+ * of this one is only given by the next access)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param value: 8-bit value to be sent
+ */
+void LCD_write_byte(char value){
+    
+    /*---------- Wait for the previous command to finish ----------*/
+    LCD_BUSY_WAIT();
+    
+    /*---------- Load higher order 4-bits ----------*/
+    LCD_D7_LAT = (value & 0b10000000) >> 7;
+    LCD_D6_LAT = (value & 0b01000000) >> 6;
+    LCD_D5_LAT = (value & 0b00100000) >> 5;
+    LCD_D4_LAT = (value & 0b00010000) >> 4;
+    
+    /*---------- Send a clock pulse ----------*/
+    LCD_pulse_clock();
+    
+    /*---------- Load lower order 4-bits ----------*/
+    LCD_D7_LAT = (value & 0b00001000) >> 3;
+    LCD_D6_LAT = (value & 0b00000100) >> 2;
+    LCD_D5_LAT = (value & 0b00000010) >> 1;
+    LCD_D4_LAT = (value & 0b00000001)     ;
+    
+    /*---------- Send a clock pulse ----------*/
+    LCD_pulse_clock();
+    
+    /*---------- Give(or record) the delay required by the command ----------*/
+    LCD_BUSY_SET(LCD_BUSY_SHORT);
+}
\ No newline at end of file
@@ -26,6 +26,15 @@
 #include "LCD.h"
 
 
+/* Initialize the global variables */
+#if LCD_USE_PAGES
+uint8_t LCD_shift;  //Characters the display is shifted to the left(0-39, tracked)
+#endif
+#if LCD_QUEUE_SIZE > 0 && LCD_QUEUE_URGENT
+uint8_t LCD_cgram;  //1 while the cursor is in CGRAM(tracked, queued characters can't interrupt)
+#endif
+
+
 /**
  * Sends an 8-bit command (in 4-bit mode)\n
  * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
@@ -33,23 +42,42 @@
  */
 void LCD_write_command(char command){
     
-    LCD_RS_LAT = 0; //Enter command mode
+#if LCD_TRACK_ADDRESS || LCD_USE_PAGES
+    uint8_t code = (uint8_t)command;  //(Only needed by the tracking below)
+#endif
     
-    /*---------- Load higher order 4-bits ----------*/
-    LCD_D7_LAT = (command & 0b10000000) >> 7;
-    LCD_D6_LAT = (command & 0b01000000) >> 6;
-    LCD_D5_LAT = (command & 0b00100000) >> 5;
-    LCD_D4_LAT = (command & 0b00010000) >> 4;
+    /*---------- Send the command(unless a batch holds it back) ----------*/
+#if LCD_USE_BATCH
+    if( !LCD_batch_open || !LCD_batch_hold(code) )
+#endif
+    {
+        LCD_RS_LAT = 0; //Enter command mode
+        LCD_write_byte(command);
+    }
     
-    /*---------- Send a clock pulse ----------*/
-    LCD_pulse_clock();
+#if LCD_TRACK_ADDRESS
+    /*---------- Keep track of where the command leaves the cursor ----------*/
+    if(code & LCD_CMD_DDRAM_SET){                                     //Set DDRAM Address
+        LCD_address = code & 0b01111111;
+    }
+    else if(code == LCD_CMD_CLEAR || (code & 0b11111110) == LCD_CMD_RETURN_HOME){  //Clear Display/Return Home
+        LCD_address = 0;
+    }
+    else if((code & 0b11111000) == LCD_CMD_CURSOR_DECREMENT){         //Increment/Decrement Cursor
+        LCD_address_step(code & 0b00000100);
+    }
+#endif
     
-    /*---------- Load lower order 4-bits ----------*/
-    LCD_D7_LAT = (command & 0b00001000) >> 3;
-    LCD_D6_LAT = (command & 0b00000100) >> 2;
-    LCD_D5_LAT = (command & 0b00000010) >> 1;
-    LCD_D4_LAT = (command & 0b00000001)     ;
+#if LCD_USE_PAGES
+    /*---------- Keep track of where the display is shifted to(for the pages) ----------*/
+    if(code == LCD_CMD_CLEAR || (code & 0b11111110) == LCD_CMD_RETURN_HOME) LCD_shift = 0;
+    if(code == LCD_CMD_SHIFT_LEFT)  LCD_shift = (LCD_shift == 39) ? 0 : (LCD_shift + 1);
+    if(code == LCD_CMD_SHIFT_RIGHT) LCD_shift = (LCD_shift == 0) ? 39 : (LCD_shift - 1);
+#endif
     
-    /*---------- Send a clock pulse ----------*/
-    LCD_pulse_clock();
+#if LCD_QUEUE_SIZE > 0 && LCD_QUEUE_URGENT
+    /*---------- Keep track of whether the cursor is in CGRAM(for "LCD_preempt") ----------*/
+    if((code & 0b11000000) == LCD_CMD_CGRAM_SET) LCD_cgram = 1;
+    if((code & LCD_CMD_DDRAM_SET) || code == LCD_CMD_CLEAR || (code & 0b11111110) == LCD_CMD_RETURN_HOME) LCD_cgram = 0;
+#endif
 }
\ No newline at end of file
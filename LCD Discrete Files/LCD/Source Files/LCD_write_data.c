@@ -35,21 +35,19 @@ void LCD_write_data(char data){
 
     LCD_RS_LAT = 1; //Enter data mode
     
-    /*---------- Load higher order 4-bits ----------*/
-    LCD_D7_LAT = (data & 0b10000000) >> 7;
-    LCD_D6_LAT = (data & 0b01000000) >> 6;
-    LCD_D5_LAT = (data & 0b00100000) >> 5;
-    LCD_D4_LAT = (data & 0b00010000) >> 4;
+    /*---------- Send the data(unless a batch leaves it out) ----------*/
+#if LCD_USE_BATCH
+    if( !LCD_batch_open || !LCD_batch_data(data) )
+#endif
+    LCD_write_byte(data);
     
-    /*---------- Send a clock pulse ----------*/
-    LCD_pulse_clock();
-    
-    /*---------- Load lower order 4-bits ----------*/
-    LCD_D7_LAT = (data & 0b00001000) >> 3;
-    LCD_D6_LAT = (data & 0b00000100) >> 2;
-    LCD_D5_LAT = (data & 0b00000010) >> 1;
-    LCD_D4_LAT = (data & 0b00000001)     ;
-    
-    /*---------- Send a clock pulse ----------*/
-    LCD_pulse_clock();
+#if LCD_TRACK_ADDRESS
+    /*---------- Keep track of the address(moves with the entry mode) ----------*/
+    LCD_address_step(LCD_mode & 0b00010000);
+#endif
+
+#if LCD_QUEUE_SIZE > 0 && LCD_QUEUE_URGENT
+    /*---------- Let the queued characters through(at the byte boundary) ----------*/
+    if(LCD_queue_tail != LCD_queue_head) LCD_preempt();
+#endif
 }
\ No newline at end of file
@@ -26,46 +26,89 @@
 #include "LCD.h"
 
 
+#if LCD_USE_FLOAT
+
 /**
- * Writes a float variable to the current cursor location\n
- * (Negative numbers will be treated as positive!)
+ * Writes a float variable to the current cursor location, rounded to
+ * "f_digit" fractional digits(same digits as printf("%.*f"))\n
+ * (Values that don't fit into 32-bits(above 4294967295) are written as '*')
  * @param variable: Variable to be written
- * @param back_offset: If the offset is bigger than the total
- * digit count(including integer digits, float digits and 1 
- * more for the '.' character), the difference amount of 
- * empty spaces will be put before writing the variable\n
+ * @param left_offset: If the offset is bigger than the total
+ * character count(including '-', integer digits, '.' and float
+ * digits), the difference amount of empty spaces will be put
+ * before writing the variable\n
  * (Allows for right to left writing while keeping the first
  * digit stationary)\n
  * @param f_digit: How many digits of the fractional part to
- * be written\n
- * (Too high value will cause the variable to overflow!)
+ * be written(max. 9, 0 to write no '.' either)
  */
 void LCD_write_float(float variable, uint8_t left_offset, uint8_t f_digit){
     
-    /*----- Calculate the left offset for the integer part.(-1 is for the '.' character) -----*/
-    /*----- (Making sure that left offset doesn't wrap back to 255.) -----*/
-    if( left_offset >= (f_digit+1) ){        
-        left_offset = (left_offset-f_digit) - 1;
+    char buffer[21];                     //Buffer to hold the characters('-', 10 integer digits, '.', 9 float digits)
+    char *end = buffer + sizeof(buffer);
+    char *digits;                        //Pointer to the first character in the buffer
+    uint8_t count;                       //Variable to hold the number of total characters
+    
+    /*----- Turn negative numbers into positive(the sign is written at the end) -----*/
+    float magnitude = (variable < 0) ? -variable : variable;
+    if( !(magnitude < 4294967296.0f) ){  //(Also catches NaN)
+        LCD_write_data('*');
+        return;
     }
-    else{
-        left_offset = 0;
+    if(f_digit > 9) f_digit = 9;
+    
+    /*----- Separate the integer part and the fraction as a 0.64 fixed-point number(all exact, no rounding) -----*/
+    uint32_t integer = (uint32_t)magnitude;
+    float    shifted = (magnitude - (float)integer) * 4294967296.0f;  //Fraction shifted left by 32 bits
+    uint32_t upper   = (uint32_t)shifted;                             //Bits 1-32 of the fraction
+    shifted          = (shifted - (float)upper) * 4294967296.0f;      //Rest shifted left by 32 bits
+    uint32_t lower   = (uint32_t)shifted;                             //Bits 33-64 of the fraction
+    uint8_t  sticky  = (shifted != (float)lower);                     //1 if there are more bits below
+    uint16_t part[4] = { (uint16_t)lower, (uint16_t)(lower >> 16), (uint16_t)upper, (uint16_t)(upper >> 16) };
+    
+    /*----- Turn the fraction into a scaled integer, one decimal digit at a time -----*/
+    uint32_t scaled = 0;  //Fractional digits as an integer
+    uint32_t limit  = 1;  //10^f_digit
+    for(uint8_t i=0 ; i < f_digit ; i++){
+        uint32_t carry = 0;
+        for(uint8_t j=0 ; j < 4 ; j++){            //Multiply the fraction by 10(16-bits at a time)...
+            carry   = (uint32_t)part[j]*10 + carry;
+            part[j] = (uint16_t)carry;
+            carry >>= 16;
+        }
+        scaled = scaled*10 + carry;               //...the part that moves above the point is the next digit
+        limit *= 10;
     }
     
-    /*----- Turn negative numbers into positive -----*/
-    if(variable < 0) variable *= -1;
-
-    /*----- Seperate the integer and fractional parts using "modff" from "math.h" -----*/
-    float integer;                           //Define a variable for the integer part
-    float fractional;                        //Define a variable for the fractional part
-    fractional = modff(variable, &integer);  //Seperate the integer and fractional parts
-
-    /*----- Write the integer part -----*/
-    LCD_write_variable( (int32_t)integer, left_offset );  //Write the integer part with given offset    
-    LCD_write_char('.');                                  //Place a dot before the fractional part
+    /*----- Round to the nearest(ties to even like printf), carrying into the integer part -----*/
+    uint8_t above = (part[2] | part[1] | part[0]) || sticky;  //1 if the rest is more than its top 16 bits
+    uint8_t odd   = (uint8_t)((f_digit ? scaled : integer) & 1);
+    if( part[3] > 0x8000 || (part[3] == 0x8000 && (above || odd)) ){
+        if(++scaled == limit){
+            scaled = 0;
+            integer++;
+        }
+    }
+    
+    /*----- Place the characters from right to left -----*/
+    digits = end;
+    if(f_digit){
+        digits = LCD_convert_digits(digits, scaled);
+        while(end - digits < f_digit) *--digits = '0';  //Leading zeros of the fractional part
+        *--digits = '.';
+    }
+    digits = LCD_convert_digits(digits, integer);
+    if( ((const uint8_t*)&variable)[sizeof(float)-1] & 0x80 ) *--digits = '-';  //(Sign bit, so -0.0 is "-0" like printf)
+    count = (uint8_t)(end - digits);
     
-    /*----- Write the fractional part -----*/
-    for(uint8_t i=0 ; i < f_digit ; i++){                           //Limit the fractional digits
-        fractional *= 10;                                           //Shift fraction to left
-        LCD_write_data( (uint8_t)((int32_t)fractional%10 + '0') );  //Write the digit(with character 0 as offset)
+    /*----- Give the offset before writing the variable -----*/
+    while(left_offset > count){
+        LCD_write_data(' ');
+        left_offset--;
     }
-}
\ No newline at end of file
+    
+    /*----- Write everything at once -----*/
+    LCD_write_buffer(digits, count);
+}
+
+#endif
\ No newline at end of file
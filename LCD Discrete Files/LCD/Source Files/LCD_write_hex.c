@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_HEX
+
+/* Characters of the hexadecimal digits(indexed by the nibble) */
+static const char LCD_hex_digits[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+
+/**
+ * Writes a variable in hexadecimal to the current cursor location(max. 32-bit)\n
+ * (e.g. 0x1A3 is written as "1A3", no "0x" is put before it)
+ * @param variable: Variable to be written
+ * @param left_offset: If the offset is bigger than the total digit
+ * count, the difference is filled before writing the variable\n
+ * (e.g. 2 for an 8-bit register, 8 for a 32-bit CAN ID)\n
+ * (Leave as 0 if you want the variable to be written as is)
+ * @param zero_pad: 1 to fill the offset with '0', 0 to fill it with empty spaces
+ */
+void LCD_write_hex(uint32_t variable, uint8_t left_offset, uint8_t zero_pad){
+    
+    char buffer[8];                        //Buffer to hold the digits(max. 8 digits for 32-bit)
+    char *end    = buffer + sizeof(buffer);
+    char *digits = end;                    //Pointer to the first digit in the buffer
+    uint8_t count;                         //Variable to hold the number of total digits
+    
+    /*---------- Convert the variable into digits(4-bits each, from right to left) ----------*/
+    do{
+        *--digits = LCD_hex_digits[variable & 0x0F];
+        variable >>= 4;
+    }while(variable);
+    
+    count = (uint8_t)(end - digits);
+    
+    /*---------- Give the offset before writing the variable ----------*/
+    while(1){
+        if(left_offset <= count) break;        //If the offset is equal to digits *or less*, break
+        LCD_write_data(zero_pad ? '0' : ' ');  //Fill the offset
+        left_offset--;                         //Decrement the offset
+    }
+    
+    /*---------- Write the variable on screen ----------*/
+    LCD_write_buffer(digits, count);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,69 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_PACKED
+
+/**
+ * Writes a text compressed by "lcd_strings"(in LCD Tools) to the current
+ * cursor location\n
+ * (The characters are sent as they are decoded, the text and the tokens
+ * are read directly from program memory, no RAM buffer is used)\n
+ * (A character costs the same as in "LCD_write_string", each token and
+ * each run of plain characters adds one "LCD_write_buffer" call)
+ * @param *text: Compressed text(e.g. LCD_texts[LCD_LANGUAGE_EN][LCD_TEXT_HELLO])
+ * @param *tokens: Token table generated together with the text(LCD_tokens)
+ */
+void LCD_write_packed(const char *text, const char * const *tokens){
+    
+    uint16_t length;  //Number of plain characters in a row
+    
+    while(*text != '\0'){
+        
+        /*---------- Write the plain characters in one go ----------*/
+        length = 0;
+        while( text[length] != '\0' && (uint8_t)text[length] < 0x80 && text[length] != LCD_PACKED_ESCAPE ) length++;
+        if(length){
+            LCD_write_buffer(text, length);
+            text += length;
+        }
+        
+        /*---------- Token(0x80 + token number): write the characters of the token ----------*/
+        if((uint8_t)*text >= 0x80){
+            LCD_write_string(tokens[(uint8_t)*text - 0x80]);
+            text++;
+        }
+        
+        /*---------- Escape: write the next byte as it is(characters 0x80-0xFF) ----------*/
+        else if(*text == LCD_PACKED_ESCAPE){
+            LCD_write_buffer(text + 1, 1);
+            text += 2;
+        }
+    }
+}
+
+#endif
\ No newline at end of file
@@ -29,12 +29,16 @@
 /**
  * Writes a string to the current cursor location\n
  * <STRONG>!!!The string has to be null terminated otherwise this function will fail or loop forever!!!</STRONG> 
- * @param *string: Character array that contains the string(max. 255 characters)
+ * @param *string: Character array that contains the string(max. 65535 characters)\n
+ * (String literals and "const" arrays are read directly from program memory)
  */
-void LCD_write_string(char *string){
+void LCD_write_string(const char *string){
    
-    /* Write all characters one by one until you reach "NULL" */
-    for(uint8_t i=0 ; string[i] != '\0' ; i++){
-        LCD_write_data(string[i]);
-    }
+    uint16_t length = 0;  //Variable to hold the length of the string
+    
+    /* Count the characters until you reach "NULL" */
+    while(string[length] != '\0') length++;
+    
+    /* Write all characters at once */
+    LCD_write_buffer(string, length);
 }
\ No newline at end of file
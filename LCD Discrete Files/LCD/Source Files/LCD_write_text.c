@@ -0,0 +1,87 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_TEXT
+
+/**
+ * Writes a text starting from the given location, wrapping onto the
+ * next row when the end of a row is reached\n
+ * (Rows follow the reading order(1-2-3-4) instead of the DDRAM order,
+ * the text continues from the first row after the last one)\n
+ * (A '\\n' character moves the text onto the next row)\n
+ * (The cursor location is only set at the start and on row changes)\n
+ * (The text goes from left to right whatever the entry mode is, the
+ * entry mode is put back after it)\n
+ * <STRONG>!!!The text has to be null terminated otherwise this function will fail or loop forever!!!</STRONG>
+ * @param *text: Character array that contains the text
+ * @param *row: Starting row position(1-4)\n
+ * (Updated to the row of the cursor after writing)
+ * @param *column: Starting column position(1-20)\n
+ * (Updated to the column of the cursor after writing, the cursor
+ * is left there so other write functions can follow without
+ * setting the cursor)
+ */
+void LCD_write_text(const char *text, uint8_t *row, uint8_t *column){
+    
+    uint8_t length;  //Number of characters to be written on the current row
+    uint8_t mode;    //Mode to be left at the end(the rows are written from left to right)
+    
+    /* Write from left to right(see "LCD_entry_forward") and set the starting cursor location */
+    mode = LCD_entry_forward();
+    LCD_cursor_set(*row, *column);
+    
+    while(1){
+        
+        /*---------- Count the characters that fit in the rest of the row ----------*/
+        length = 0;
+        while( text[length] != '\0' && text[length] != '\n' && length <= (LCD_COLUMNS - *column) ){
+            length++;
+        }
+        
+        /*---------- Write them at once ----------*/
+        LCD_write_buffer(text, length);
+        text    += length;
+        *column += length;
+        
+        /*---------- Decide whether to move onto the next row ----------*/
+        if(*text == '\n') text++;                     //Skip the new line character(also when the row is just full)
+        else if(*column <= LCD_COLUMNS) break;        //If the text ended before the end of the row, break
+        
+        /*---------- Move onto the next row(back to row 1 after the last row) ----------*/
+        *column = 1;
+        *row = (*row < LCD_ROWS) ? (*row + 1) : 1;
+        LCD_cursor_set(*row, *column);
+        
+        /*---------- If the text ended right at the end of the row, break ----------*/
+        if(*text == '\0') break;
+    }
+    
+    LCD_entry_restore(mode);
+}
+
+#endif
\ No newline at end of file
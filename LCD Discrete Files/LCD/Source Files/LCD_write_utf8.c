@@ -0,0 +1,125 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "LCD.h"
+
+
+#if LCD_USE_UTF8
+
+/* Code points that the ROM has(sorted) and the character codes they are at */
+#if LCD_CHARSET_A02
+static const uint16_t LCD_utf8_points[] = { 0x201C, 0x201D, 0x2190, 0x2191, 0x2192, 0x2193, 0x21B5, 0x2264,
+                                            0x2265, 0x2302, 0x25B2, 0x25B6, 0x25BC, 0x25C0, 0x25CF };
+static const char     LCD_utf8_codes[]  = { 0x12,   0x13,   0x1B,   0x18,   0x1A,   0x19,   0x17,   0x1C,
+                                            0x1D,   0x7F,   0x1E,   0x10,   0x1F,   0x11,   0x16 };
+#else
+static const uint16_t LCD_utf8_points[] = { 0x00A2, 0x00A5, 0x00B0, 0x00B5, 0x00B7, 0x00DF, 0x00E4, 0x00F1,
+                                            0x00F6, 0x00F7, 0x00FC, 0x03A3, 0x03A9, 0x03B1, 0x03B2, 0x03B5,
+                                            0x03B8, 0x03BC, 0x03C0, 0x03C1, 0x03C3, 0x2190, 0x2192, 0x221A,
+                                            0x221E, 0x2588 };
+static const char     LCD_utf8_codes[]  = { 0xEC,   0x5C,   0xDF,   0xE4,   0xA5,   0xE2,   0xE1,   0xEE,
+                                            0xEF,   0xFD,   0xF5,   0xF6,   0xF4,   0xE0,   0xE2,   0xE3,
+                                            0xF2,   0xE4,   0xF7,   0xE6,   0xE5,   0x7F,   0x7E,   0xE8,
+                                            0xF3,   0xFF };
+#endif
+
+
+/**
+ * Writes a UTF-8 encoded string to the current cursor location\n
+ * (ASCII characters are written as they are, others are written with
+ * their character code in the LCD's ROM(A00 or A02, see "LCD_CHARSET_A02"),
+ * or as a custom character given with "LCD_utf8_glyphs", or as '?')\n
+ * (Custom characters are loaded into the last "LCD_UTF8_SLOTS" CGRAM
+ * locations in turns, a string shouldn't use more different ones than that)\n
+ * <STRONG>!!!The string has to be null terminated otherwise this function will fail or loop forever!!!</STRONG>
+ * @param *string: Character array that contains the UTF-8 string
+ */
+void LCD_write_utf8(const char *string){
+    
+    uint16_t length;  //Length of the current run of ASCII characters
+    uint16_t point;   //Code point of the current character
+    uint8_t  code;    //Character code to be written(0 if not found yet)
+    
+    while(1){
+        
+        /*---------- Write the run of ASCII characters(0x01-0x7F) at once ----------*/
+        length = 0;
+        while( (uint8_t)(string[length] - 1) < 0x7F ) length++;
+        LCD_write_buffer(string, length);
+        string += length;
+        if(*string == '\0') break;
+        
+        /*---------- Decode the multi-byte character ----------*/
+        uint8_t lead   = (uint8_t)*string++;  //First byte tells the number of continuation bytes
+        uint8_t follow = 0;
+        point = 0;
+        if     ((lead & 0b11100000) == 0b11000000){ point = lead & 0b00011111; follow = 1; }
+        else if((lead & 0b11110000) == 0b11100000){ point = lead & 0b00001111; follow = 2; }
+        else if((lead & 0b11111000) == 0b11110000){ follow = 3; }  //(Outside 16-bits, can't be shown)
+        for( ; follow ; follow--){
+            if( ((uint8_t)*string & 0b11000000) != 0b10000000 ) break;  //Stop on a cut sequence
+            point = (uint16_t)(point << 6) | ((uint8_t)*string++ & 0b00111111);
+        }
+        if( follow || (lead & 0b11111000) == 0b11110000 || point < 0x80 ) point = 0xFFFF;  //Invalid
+        
+        /*---------- Look for the character in the ROM(binary search) ----------*/
+        uint8_t low  = 0;
+        uint8_t high = sizeof(LCD_utf8_points) / sizeof(LCD_utf8_points[0]);
+        while(low < high){
+            uint8_t middle = (low + high) >> 1;
+            if(LCD_utf8_points[middle] < point) low  = middle + 1;
+            else                                high = middle;
+        }
+        code = 0;
+        if(low < sizeof(LCD_utf8_points) / sizeof(LCD_utf8_points[0]) && LCD_utf8_points[low] == point){
+            code = (uint8_t)LCD_utf8_codes[low];
+        }
+        if(point >= LCD_UTF8_RANGE_FIRST && point <= LCD_UTF8_RANGE_LAST){
+            code = (uint8_t)(point - LCD_UTF8_RANGE_FIRST + LCD_UTF8_RANGE_CODE);
+        }
+        
+#if LCD_UTF8_SLOTS > 0
+        /*---------- If it's not in the ROM, look for it in the CGRAM ----------*/
+        for(uint8_t i=0 ; i < LCD_UTF8_SLOTS && !code ; i++){
+            if(LCD_utf8_slot_points[i] == point) code = (8 - LCD_UTF8_SLOTS) + i;
+        }
+        
+        /*---------- If it's not in the CGRAM either, load it from the custom characters ----------*/
+        for(uint8_t i=0 ; i < LCD_utf8_glyph_count && !code ; i++){
+            if(LCD_utf8_glyph_points[i] != point) continue;
+            uint8_t slot = LCD_utf8_slot_next;
+            LCD_utf8_slot_next = (slot + 1 < LCD_UTF8_SLOTS) ? (slot + 1) : 0;
+            LCD_set_character(LCD_utf8_glyph_patterns + (uint16_t)i * 8, (8 - LCD_UTF8_SLOTS) + slot);
+            LCD_utf8_slot_points[slot] = point;
+            code = (8 - LCD_UTF8_SLOTS) + slot;
+        }
+#endif
+        
+        /*---------- Write the character('?' if it can't be shown) ----------*/
+        LCD_write_data(code ? (char)code : '?');
+    }
+}
+
+#endif
\ No newline at end of file
@@ -40,35 +40,24 @@
  */
 void LCD_write_variable(int32_t variable, uint8_t left_offset){
     
-    int32_t temp_variable;  //Temporary variable to work on
-    uint8_t digits = 0;     //Variable to hold the number of total digits
+    char buffer[10];  //Buffer to hold the digits(max. 10 digits for 32-bit)
+    char *digits;     //Pointer to the first digit in the buffer
+    uint8_t count;    //Variable to hold the number of total digits
     
-    /*----- Turn negative numbers into positive -----*/
-    if(variable < 0) variable *= -1;
+    /*----- Turn negative numbers into positive(unsigned, so -2147483648 fits too) -----*/
+    uint32_t magnitude = (variable < 0) ? -(uint32_t)variable : (uint32_t)variable;
     
-    /*---------- Calculate the total digits ----------*/
-    temp_variable = variable;          //Copy the variable
-    while(1){                          //...
-        digits++;                      //Increment the digit(do first since even 0 will have 1 digit)
-        if(temp_variable < 10) break;  //If the number has 1 digit left, break
-        temp_variable /= 10;           //Shift the number to the right
-    }
+    /*---------- Convert the variable into digits ----------*/
+    digits = LCD_convert_digits(buffer + sizeof(buffer), magnitude);
+    count  = (uint8_t)((buffer + sizeof(buffer)) - digits);
     
     /*---------- Give the offset before writing the variable ----------*/
     while(1){
-        if(left_offset <= digits) break;  //If the offset is equal to digits *or less*, break
-        LCD_write_data(' ');              //Put an empty space
-        left_offset--;                    //Decrement the offset
+        if(left_offset <= count) break;  //If the offset is equal to digits *or less*, break
+        LCD_write_data(' ');             //Put an empty space
+        left_offset--;                   //Decrement the offset
     }
     
     /*---------- Write the variable on screen ----------*/
-    while(1){
-        temp_variable = variable;                    //Copy/re-copy the variable
-        for(uint8_t i = 1 ; i < digits ; i++){       //Shift the temporary variable *digits* times
-            temp_variable /= 10;                     //...
-        }                                            //...
-        LCD_write_data( (temp_variable%10) + '0' );  //Write the digit(with character 0 as offset)
-        digits --;                                   //Decrement the *digits*(to move onto next)
-        if(digits == 0) break;                       //If *digits* reaches 0, break
-    }
+    LCD_write_buffer(digits, count);
 }
\ No newline at end of file
@@ -63,8 +63,73 @@
     #define LCD_D6_LAT LATAbits.LATA4  //LAT bit of the pin connected to "D6"
     #define LCD_D7_LAT LATAbits.LATA5  //LAT bit of the pin connected to "D7"
 
+    #define LCD_USE_RW 0                  //1 if "R/W" is connected to a pin(enables reading), 0 if it's tied to ground
+    #define LCD_RW_TRIS TRISAbits.TRISA6  //TRIS bit of the pin connected to "R/W"(only used if LCD_USE_RW is 1)
+    #define LCD_RW_LAT  LATAbits.LATA6    //LAT bit of the pin connected to "R/W"(only used if LCD_USE_RW is 1)
+    #define LCD_D4_PORT PORTAbits.RA2     //PORT bit of the pin connected to "D4"(only used if LCD_USE_RW is 1)
+    #define LCD_D5_PORT PORTAbits.RA3     //PORT bit of the pin connected to "D5"(only used if LCD_USE_RW is 1)
+    #define LCD_D6_PORT PORTAbits.RA4     //PORT bit of the pin connected to "D6"(only used if LCD_USE_RW is 1)
+    #define LCD_D7_PORT PORTAbits.RA5     //PORT bit of the pin connected to "D7"(only used if LCD_USE_RW is 1)
+
     #define _XTAL_FREQ 64000000  //Frequency of the sytem clock
 
+    #define LCD_USE_TIMER          0     //1 if a free-running 16-bit timer is available(see below), 0 to use delays
+    #define LCD_TIMER              TMR1  //16-bit register of the free-running timer(only used if LCD_USE_TIMER is 1)
+    #define LCD_TIMER_TICKS_PER_US 1     //Timer ticks per microsecond(1-8, only used if LCD_USE_TIMER is 1)
+
+    #define LCD_CALIBRATE        0   //1 to measure the delays of the LCD at init(needs LCD_USE_RW and LCD_USE_TIMER)
+    #define LCD_CALIBRATE_MARGIN 25  //Safety margin added to the measured delays[%]
+
+    #define LCD_USE_FLOAT 0  //1 to include "LCD_write_float"(and the float library), 0 to leave it out
+
+    #define LCD_USE_HEX           0  //1 to include "LCD_write_hex" and "LCD_write_bin", 0 to leave them out
+    #define LCD_USE_TEXT          0  //1 to include "LCD_write_text", 0 to leave it out
+    #define LCD_USE_EXEC          0  //1 to include "LCD_exec"(needed by the screens of "LCD.hpp"), 0 to leave it out
+    #define LCD_USE_SET_CHARACTER 0  //1 to include "LCD_set_character", 0 to leave it out(it needs the cursor address to be tracked)
+
+    #define LCD_ROWS    4   //Number of rows of the LCD(2 for 2x16, 4 for 4x20)
+    #define LCD_COLUMNS 20  //Number of columns of the LCD(16 for 2x16, 20 for 4x20)
+
+    #define LCD_FIELD_COUNT 0  //Max. number of display fields(see "LCD_field_add", 0 to disable)
+    #define LCD_FIELD_WIDTH 8  //Max. width of a display field in characters
+
+    #define LCD_FRAME_RATE 0     //Max. screen updates per second(see "LCD_frame_update", 0 to disable)
+    #define LCD_TICK_RATE  1000  //How many times per second "LCD_tick" is called
+
+    #define LCD_ANIM_COUNT 0  //Max. custom character animations(see "LCD_anim_add", max. 8, 0 to disable)
+
+    #define LCD_USE_PAGES 0  //1 to include page flipping(see "LCD_page_flip", only for LCDs with 1-2 rows and 20 columns or less)
+    #if LCD_USE_PAGES && LCD_ROWS > 2
+    #error "LCD_USE_PAGES needs an LCD with 1 or 2 rows(rows 3-4 already use the rest of the DDRAM lines)"
+    #endif
+    #if LCD_USE_PAGES && LCD_COLUMNS > 20
+    #error "LCD_USE_PAGES needs an LCD with 20 columns or less(2 pages have to fit into a DDRAM line)"
+    #endif
+
+    #define LCD_BIGNUM_COUNT  0  //Max. number of big-digit numbers(see "LCD_bignum_add", 0 to disable)
+    #define LCD_BIGNUM_DIGITS 4  //Max. digits of a big-digit number(each digit takes 3 columns + 1 space)
+    #define LCD_BIGNUM_ROWS   2  //Height of the big digits in rows(2 or 4)
+    #define LCD_BIGNUM_GLYPH  2  //First of the 3 CGRAM locations used by the big digits(0-5, 4 locations and 0-4 with LCD_CHARSET_A02)
+
+    #define LCD_VERIFY_CHUNK 4  //Cells checked by each "LCD_verify" call(needs LCD_USE_RW and the frame)
+
+    #define LCD_QUEUE_SIZE   0   //Max. characters waiting in "LCD_post_char" queue(power of 2, 0 to disable)
+    #define LCD_QUEUE_URGENT 1   //1 to send the queued characters in the middle of any write(0 to wait for "LCD_drain")
+
+    #define LCD_USE_BATCH 0  //1 to include command batching(see "LCD_batch_begin")
+
+    #define LCD_USE_PACKED 0  //1 to include "LCD_write_packed"(compressed texts made by "lcd_strings" in LCD Tools)
+
+    #define LCD_TRACE_SIZE 0  //Bus events kept by the trace(power of 2, see "LCD_trace_dump", 0 to disable)
+
+    #define LCD_USE_UTF8 0  //1 to include "LCD_write_utf8"(and its character tables)
+
+    #define LCD_CHARSET_A02 0  //Character ROM of the LCD used by "LCD_write_utf8"(0 for A00/japanese, 1 for A02/european)
+    #define LCD_UTF8_SLOTS  2  //CGRAM locations(7 and below) used for characters missing in the ROM(1-7, 0 to disable)
+    #if LCD_BIGNUM_COUNT > 0 && LCD_USE_UTF8 && LCD_UTF8_SLOTS > 0 && LCD_BIGNUM_GLYPH + 3 + LCD_CHARSET_A02 > 8 - LCD_UTF8_SLOTS
+    #error "The big digits and LCD_write_utf8 use the same CGRAM locations(lower LCD_BIGNUM_GLYPH or LCD_UTF8_SLOTS)"
+    #endif
+
     /**************************************************************************/
     /*************************** Necessary includes ***************************/
     /**************************************************************************/
@@ -72,6 +137,27 @@
     #include <xc.h>
     #include <stdint.h>
     
+    /**************************************************************************/
+    /************************* Bytecode of "LCD_exec" *************************/
+    /**************************************************************************/
+
+    #define LCD_OP_END     0x00  //End of the program
+    #define LCD_OP_ADDRESS 0x01  //+ address(see "LCD_AT"): Sets the cursor
+    #define LCD_OP_WRITE   0x02  //+ count + characters: Writes the characters
+    #define LCD_OP_FILL    0x03  //+ count + character: Writes the same character "count" times
+    #define LCD_OP_GLYPH   0x04  //+ location + 8 pattern bytes: Changes a custom character(cursor doesn't move)
+    #define LCD_OP_CONFIG  0x05  //+ mode(LCD_MODE_... bits below): Sets the display and entry mode(entry mode after the program)
+    #define LCD_OP_CLEAR   0x06  //Clears the screen
+    #define LCD_OP_VALUE   0x07  //+ index + width + f_digit: Writes values[index] right aligned(max. 12 wide, see "LCD_field_set")
+
+    #define LCD_MODE_BLINK     0b00000001  //Cursor blinking on
+    #define LCD_MODE_CURSOR    0b00000010  //Cursor on
+    #define LCD_MODE_DISPLAY   0b00000100  //Display on
+    #define LCD_MODE_SHIFT     0b00001000  //Entry shift on
+    #define LCD_MODE_INCREMENT 0b00010000  //Entry increment(decrement if not set)
+
+    #define LCD_AT(row, column) ( ((row) == 1 ? 0x00 : (row) == 2 ? 0x40 : (row) == 3 ? 0x14 : 0x54) + (column) - 1 )  //DDRAM address of a location(for "LCD_OP_ADDRESS")
+
     /**************************************************************************/
     /*************************** Function prototypes **************************/
     /**************************************************************************/
@@ -87,14 +173,53 @@
     void LCD_shift_reset(void);
     void LCD_shift_left(void);
     void LCD_shift_right(void);    
+    void LCD_page_cursor_set(uint8_t, uint8_t, uint8_t);
+    void LCD_page_flip(uint8_t);
+    void LCD_page_clear(uint8_t);
     void LCD_configure_entry_id(uint8_t);
     void LCD_configure_entry_shift(uint8_t);
-    void LCD_add_character(char*, uint8_t);
+    void LCD_add_character(const char*, uint8_t);
+    void LCD_set_character(const char*, uint8_t);
     
-    void LCD_write_string(char*);
+    void LCD_write_buffer(const char*, uint16_t);
+    void LCD_write_string(const char*);
+    void LCD_write_packed(const char*, const char * const*);
+    void LCD_write_text(const char*, uint8_t*, uint8_t*);
     void LCD_write_char(char);
+    void LCD_write_utf8(const char*);
+    void LCD_utf8_glyphs(const uint16_t*, const char*, uint8_t);
     void LCD_write_variable(int32_t, uint8_t);
+    void LCD_write_hex(uint32_t, uint8_t, uint8_t);
+    void LCD_write_bin(uint32_t, uint8_t, uint8_t);
     void LCD_write_float(float, uint8_t, uint8_t);
+    void LCD_exec(const uint8_t*, const int32_t*);
+    
+    void LCD_field_add(uint8_t, uint8_t, uint8_t, uint8_t, uint8_t);
+    void LCD_field_set(uint8_t, int32_t);
+    
+    void LCD_bignum_add(uint8_t, uint8_t, uint8_t, uint8_t, uint8_t);
+    void LCD_bignum_set(uint8_t, int32_t);
+    
+    void LCD_tick(void);
+    void LCD_frame_clear(void);
+    void LCD_frame_write_char(uint8_t, uint8_t, char);
+    void LCD_frame_write_string(uint8_t, uint8_t, const char*);
+    uint8_t LCD_frame_update(void);
+    uint8_t LCD_verify(void);
+    uint8_t LCD_resync(void);
+    
+    void LCD_anim_add(uint8_t, uint8_t, const char*, uint8_t, uint16_t);
+    void LCD_anim_stop(uint8_t);
+    uint8_t LCD_anim_update(void);
+    
+    uint8_t LCD_post_char(uint8_t, uint8_t, char);
+    uint8_t LCD_post_string(uint8_t, uint8_t, const char*);
+    uint8_t LCD_drain(void);
+    
+    void LCD_batch_begin(void);
+    uint16_t LCD_batch_end(void);
+    
+    void LCD_trace_dump(void (*)(char));
     
     
 #endif	/* LCD_H */
\ No newline at end of file
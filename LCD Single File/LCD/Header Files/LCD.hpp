@@ -0,0 +1,208 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/* 
+ * C++ front-end of the library(header-only, needs C++17).
+ *
+ * Everything is forwarded to the "LCD_..." functions, so the pins, the
+ * timing and the features are still configured in "LCD.h". What this
+ * header adds is the compile-time part:
+ *  - Locations given as template arguments are checked against the
+ *    geometry and turned into DDRAM addresses by the compiler.
+ *  - Static screens(text at fixed locations) are turned into "LCD_exec"
+ *    programs by the compiler, so only the bytes that are sent to the LCD
+ *    end up in program memory.
+ *
+ * Example:
+ *  using Display = LCD::Lcd<4, 20>;
+ *  static constexpr auto screen = Display::screen(Display::clear(),
+ *                                                 Display::text<1, 1>("Temp:"),
+ *                                                 Display::value<1, 7>(0, 6, 1));
+ *  Display::init();
+ *  Display::exec(screen, values);
+ */
+
+#ifndef LCD_HPP
+    #define	LCD_HPP
+
+    extern "C" {
+    #include "LCD.h"
+    }
+
+    #include <stddef.h>
+    
+    
+namespace LCD {
+
+/**
+ * Bytes of an "LCD_exec" program(or a piece of one), built at compile time
+ */
+template<size_t Size>
+struct Program {
+    
+    uint8_t code[Size];
+    
+    /* Joins two pieces into one program */
+    template<size_t Other>
+    constexpr Program<Size + Other> operator+(const Program<Other> &other) const {
+        Program<Size + Other> joined{};
+        for(size_t i=0 ; i < Size ; i++)  joined.code[i]        = code[i];
+        for(size_t i=0 ; i < Other ; i++) joined.code[Size + i] = other.code[i];
+        return joined;
+    }
+    
+    constexpr const uint8_t* data() const { return code; }
+};
+
+/**
+ * LCD with the given number of rows and columns, all functions are static\n
+ * (They have to be the ones in "LCD.h", the "LCD_..." functions are built
+ * for that geometry, the arguments only make it visible where it's used)
+ */
+template<uint8_t Rows = LCD_ROWS, uint8_t Columns = LCD_COLUMNS>
+struct Lcd {
+    
+    static_assert(Rows == LCD_ROWS && Columns == LCD_COLUMNS, "Rows and columns have to match LCD_ROWS and LCD_COLUMNS in LCD.h");
+    static_assert(Rows >= 1 && Rows <= 4, "1-4 rows");
+    static_assert(Columns >= 1 && Columns <= 40 && (Rows <= 2 || Columns <= 20), "Rows must fit into the 80 character DDRAM");
+    
+    /**
+     * DDRAM address of a location(rows 3-4 are the continuation of rows 1-2)
+     * @param row: Row position(1-4)
+     * @param column: Column position(1-40)
+     */
+    static constexpr uint8_t address(uint8_t row, uint8_t column){
+        return (uint8_t)( ((row == 2 || row == 4) ? 0x40 : 0x00) + ((row >= 3) ? Columns : 0) + column - 1 );
+    }
+    
+    /*---------- Pieces of a static screen(see "screen") ----------*/
+    
+    /**
+     * Clears the screen
+     */
+    static constexpr Program<1> clear(){
+        return Program<1>{ { LCD_OP_CLEAR } };
+    }
+    
+    /**
+     * Writes a string literal at a location
+     * @param text: String literal(max. 255 characters, has to fit into the row)
+     */
+    template<uint8_t Row, uint8_t Column, size_t N>
+    static constexpr Program<N + 3> text(const char (&text)[N]){
+        
+        static_assert(Row >= 1 && Row <= Rows && Column >= 1 && Column <= Columns, "Location is outside of the screen");
+        static_assert(N >= 2 && Column + (N - 1) - 1 <= Columns, "Text doesn't fit into the row");
+        
+        Program<N + 3> piece{};
+        piece.code[0] = LCD_OP_ADDRESS;
+        piece.code[1] = address(Row, Column);
+        piece.code[2] = LCD_OP_WRITE;
+        piece.code[3] = (uint8_t)(N - 1);
+        for(size_t i=0 ; i < N - 1 ; i++) piece.code[4 + i] = (uint8_t)text[i];
+        return piece;
+    }
+    
+    /**
+     * Writes a live value at a location when the screen is run(see "LCD_exec")
+     * @param index: Index of the value in the values array
+     * @param width: Width of the value(max. 12)
+     * @param f_digit: Fractional digits(value is fixed-point)
+     */
+    template<uint8_t Row, uint8_t Column>
+    static constexpr Program<6> value(uint8_t index, uint8_t width, uint8_t f_digit){
+        
+        static_assert(Row >= 1 && Row <= Rows && Column >= 1 && Column <= Columns, "Location is outside of the screen");
+        
+        return Program<6>{ { LCD_OP_ADDRESS, address(Row, Column), LCD_OP_VALUE, index, width, f_digit } };
+    }
+    
+    /**
+     * Changes a custom character(cursor doesn't move)
+     * @param pattern: Binary pattern of the character
+     */
+    template<uint8_t Location>
+    static constexpr Program<10> glyph(const char (&pattern)[8]){
+        
+        static_assert(Location <= 7, "CGRAM location has to be 0-7");
+        
+        Program<10> piece{ { LCD_OP_GLYPH, Location } };
+        for(size_t i=0 ; i < 8 ; i++) piece.code[2 + i] = (uint8_t)pattern[i];
+        return piece;
+    }
+    
+    /**
+     * Joins the pieces into a program for "exec"(ends it with "LCD_OP_END")\n
+     * (Declare the result "static constexpr" to keep it in program memory)
+     */
+    template<typename... Pieces>
+    static constexpr auto screen(const Pieces&... pieces){
+        return (pieces + ... + Program<1>{ { LCD_OP_END } });
+    }
+    
+    /*---------- Functions(same as the "LCD_..." ones) ----------*/
+    
+    static void init()                                                            { LCD_init(); }
+    static void write(const char *string)                                         { LCD_write_string(string); }
+    static void write_char(char character)                                        { LCD_write_char(character); }
+    static void write_variable(int32_t variable, uint8_t left_offset = 0)         { LCD_write_variable(variable, left_offset); }
+#if LCD_USE_FLOAT
+    static void write_float(float variable, uint8_t left_offset, uint8_t f_digit) { LCD_write_float(variable, left_offset, f_digit); }
+#endif
+#if LCD_USE_PACKED
+    static void write_packed(const char *text, const char * const *tokens)        { LCD_write_packed(text, tokens); }
+#endif
+    
+    /**
+     * Sets the cursor location(checked at compile time)
+     */
+    template<uint8_t Row, uint8_t Column>
+    static void cursor(){
+        static_assert(Row >= 1 && Row <= Rows && Column >= 1 && Column <= Columns, "Location is outside of the screen");
+        LCD_cursor_set(Row, Column);
+    }
+    
+    /**
+     * Writes a string at a location(checked at compile time)
+     */
+    template<uint8_t Row, uint8_t Column>
+    static void write_at(const char *string){
+        cursor<Row, Column>();
+        LCD_write_string(string);
+    }
+    
+    /**
+     * Runs a program built with "screen"(needs LCD_USE_EXEC in "LCD.h")
+     * @param values: Live values of the "value" pieces(can be NULL if there are none)
+     */
+    template<size_t Size>
+    static void exec(const Program<Size> &program, const int32_t *values = NULL){
+        LCD_exec(program.data(), values);
+    }
+};
+
+}
+
+#endif	/* LCD_HPP */
\ No newline at end of file
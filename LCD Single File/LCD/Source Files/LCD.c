@@ -30,14 +30,32 @@
  */
 
 #include "LCD.h"
-#include <math.h>
 
 #define LCD_BUSY_DELAY           60                    //Minimum delay required by short commands[uS]
 #define LCD_BUSY_DELAY_EXTENDED (2300-LCD_BUSY_DELAY)  //Extra delay required by the longer commands[uS]
 
+#if LCD_CALIBRATE && LCD_USE_RW && LCD_USE_TIMER
+#define LCD_BUSY_SHORT           LCD_busy_short           //Delay given to short commands[uS](measured by "LCD_calibrate")
+#define LCD_BUSY_LONG            LCD_busy_long            //Extra delay given to the longer commands[uS](measured by "LCD_calibrate")
+#else
+#define LCD_BUSY_SHORT           LCD_BUSY_DELAY           //Delay given to short commands[uS]
+#define LCD_BUSY_LONG            LCD_BUSY_DELAY_EXTENDED  //Extra delay given to the longer commands[uS]
+#endif
+
+#if LCD_USE_TIMER
+#define LCD_BUSY_TICKS_MAX      ((LCD_BUSY_DELAY+LCD_BUSY_DELAY_EXTENDED) * LCD_TIMER_TICKS_PER_US)                 //Longest possible wait[timer ticks]
+#define LCD_BUSY_SET(delay)     (LCD_ready_at = (uint16_t)(LCD_TIMER + (delay) * LCD_TIMER_TICKS_PER_US))          //LCD will be ready after "delay"[uS] from now
+#define LCD_BUSY_EXTEND(delay)  (LCD_ready_at += (uint16_t)((delay) * LCD_TIMER_TICKS_PER_US))                     //LCD will be ready "delay"[uS] later than before
+#define LCD_BUSY_WAIT()         while( (uint16_t)(LCD_ready_at - LCD_TIMER - 1) < LCD_BUSY_TICKS_MAX )            //Wait for only the remaining time
+#else
+#define LCD_BUSY_SET(delay)     __delay_us(delay)  //No timer, give the delay right away
+#define LCD_BUSY_EXTEND(delay)  __delay_us(delay)  //...
+#define LCD_BUSY_WAIT()                            //(Nothing left to wait for)
+#endif
+
 #define LCD_CMD_FUNCTION_SET     0x28  //Function Set(4-bit, 2 line, 5x8 dots)
-#define LCD_CMD_DISPLAY_CONTROL  0x0C  //Display On/Off Control(Display on, cursor off, blinking off)
-#define LCD_CMD_ENTRY_MODE       0x06  //Entry Mode Set(Increment, shift off)
+#define LCD_CMD_DISPLAY_CONTROL  0x08  //Display On/Off Control(+ display, cursor and blinking bits)
+#define LCD_CMD_ENTRY_MODE       0x04  //Entry Mode Set(+ increment and shift bits)
 #define LCD_CMD_CLEAR            0x01  //Clear Display
 #define LCD_CMD_RETURN_HOME      0x02  //Return Home(or shift reset)
 #define LCD_CMD_SHIFT_LEFT       0x18  //Shift Left
@@ -45,17 +63,167 @@
 #define LCD_CMD_CURSOR_INCREMENT 0x14  //Increment Cursor
 #define LCD_CMD_CURSOR_DECREMENT 0x10  //Decrement Cursor
 #define LCD_CMD_CGRAM_SET        0x40  //Set CGRAM Address
+#define LCD_CMD_DDRAM_SET        0x80  //Set DDRAM Address
 
 #define LCD_CMD_DDRAM_LINE_1 (0x80-1)   //DDRAM address for line-1(-1 from row starting from 1 instead of 0)
 #define LCD_CMD_DDRAM_LINE_2 (0xC0-1)   //DDRAM address for line-2(-1 from row starting from 1 instead of 0)
 #define LCD_CMD_DDRAM_LINE_3 (0x80+19)  //DDRAM address for line-3(+19 from 3rd line being the continuation of line-1)
 #define LCD_CMD_DDRAM_LINE_4 (0xC0+19)  //DDRAM address for line-4(+19 from 4th line being the continuation of line-2)
 
+#define LCD_MODE_DEFAULT    0b00010100                                      //Display on, cursor off, blinking off(bits 0-2), increment, shift off(bits 3-4)
+#define LCD_DISPLAY_CONTROL (LCD_CMD_DISPLAY_CONTROL | (LCD_mode & 0b00000111))  //Display On/Off Control command with the current bits
+#define LCD_ENTRY_MODE      (LCD_CMD_ENTRY_MODE | (LCD_mode >> 3))              //Entry Mode Set command with the current bits
+
+/* The cursor address is only tracked if something puts the cursor back or checks where it is */
+#define LCD_TRACK_ADDRESS (LCD_USE_SET_CHARACTER || LCD_USE_EXEC || LCD_BIGNUM_COUNT > 0 || LCD_ANIM_COUNT > 0 || LCD_QUEUE_SIZE > 0 || LCD_USE_BATCH || (LCD_USE_UTF8 && LCD_UTF8_SLOTS > 0) || (LCD_USE_RW && LCD_FRAME_RATE > 0))
+
+#if LCD_CHARSET_A02
+#define LCD_UTF8_RANGE_FIRST 0x00A0  //First code point of the range the ROM has in order(Latin-1)
+#define LCD_UTF8_RANGE_LAST  0x00FF  //Last code point of the range
+#define LCD_UTF8_RANGE_CODE  0xA0    //Character code of the first code point
+#else
+#define LCD_UTF8_RANGE_FIRST 0xFF61  //First code point of the range the ROM has in order(half-width katakana)
+#define LCD_UTF8_RANGE_LAST  0xFF9F  //Last code point of the range
+#define LCD_UTF8_RANGE_CODE  0xA1    //Character code of the first code point
+#endif
+
+#define LCD_PAGE_COUNT (40/LCD_COLUMNS)  //Pages that fit into the 40 characters of a DDRAM line
+
+#define LCD_BIGNUM_MINUS 10  //Symbol number of '-' in the big-digit font(0-9 are the digits)
+#define LCD_BIGNUM_BLANK 11  //Symbol number of an empty digit
+#define LCD_BIG_UP (LCD_BIGNUM_GLYPH+0)  //Custom character with a bar at the top
+#define LCD_BIG_LO (LCD_BIGNUM_GLYPH+1)  //Custom character with a bar at the bottom
+#define LCD_BIG_UL (LCD_BIGNUM_GLYPH+2)  //Custom character with bars at the top and the bottom
+#if LCD_CHARSET_A02
+#define LCD_BIG_FU (LCD_BIGNUM_GLYPH+3)  //Full block(custom character, the A02 ROM doesn't have one)
+#define LCD_BIGNUM_GLYPHS 4              //Custom characters used by the big digits
+#else
+#define LCD_BIG_FU ((char)0xFF)          //Full block(in the ROM)
+#define LCD_BIGNUM_GLYPHS 3              //Custom characters used by the big digits
+#endif
+#define LCD_BIG_NO ' '                   //Empty cell
+
+#define LCD_FRAME_DIRTY_BYTES ((LCD_COLUMNS+7)/8)  //Bytes needed for the changed marks of a row
+
+#define LCD_PACKED_ESCAPE 0x1F  //Byte of a packed text telling that the next byte is a character(see "LCD_write_packed")
+
+#define LCD_RESYNC_PROBE 0x12  //DDRAM address read back by "LCD_resync"(different nibbles, so a mixed up read can't match it)
+
 
 /* Initialize the global variables */
-static uint8_t LCD_display_control = LCD_CMD_DISPLAY_CONTROL;
-static uint8_t LCD_entry_mode      = LCD_CMD_ENTRY_MODE;
+static uint8_t LCD_mode = LCD_MODE_DEFAULT;  //Display control and entry mode bits packed in one byte
+#if LCD_TRACK_ADDRESS
+static uint8_t LCD_address;                  //DDRAM address the cursor is at(tracked, without reading the LCD)
+#endif
+#if LCD_USE_PAGES
+static uint8_t LCD_shift;                    //Characters the display is shifted to the left(0-39, tracked)
+#endif
+#if LCD_QUEUE_SIZE > 0 && LCD_QUEUE_URGENT
+static uint8_t LCD_cgram;                    //1 while the cursor is in CGRAM(tracked, queued characters can't interrupt)
+#endif
+
+#if LCD_USE_TIMER
+static uint16_t LCD_ready_at;  //Timer value when the LCD will finish the last command
+#endif
+#if LCD_CALIBRATE && LCD_USE_RW && LCD_USE_TIMER
+static uint16_t LCD_busy_short = LCD_BUSY_DELAY;           //Delay given to short commands[uS](measured by "LCD_calibrate")
+static uint16_t LCD_busy_long  = LCD_BUSY_DELAY_EXTENDED;  //Extra delay given to the longer commands[uS](measured by "LCD_calibrate")
+#endif
+
+#if LCD_FIELD_COUNT > 0
+static uint8_t LCD_field_row[LCD_FIELD_COUNT];                   //Row of each field
+static uint8_t LCD_field_column[LCD_FIELD_COUNT];                //Column of each field
+static uint8_t LCD_field_width[LCD_FIELD_COUNT];                 //Width of each field
+static uint8_t LCD_field_f_digit[LCD_FIELD_COUNT];               //Fractional digits of each field
+static char    LCD_field_text[LCD_FIELD_COUNT][LCD_FIELD_WIDTH];  //Last rendered characters of each field
+#endif
+
+#if LCD_BIGNUM_COUNT > 0
+static uint8_t LCD_bignum_row[LCD_BIGNUM_COUNT];                     //Top row of each big-digit number
+static uint8_t LCD_bignum_column[LCD_BIGNUM_COUNT];                  //Left column of each big-digit number
+static uint8_t LCD_bignum_digits[LCD_BIGNUM_COUNT];                  //Number of digits of each big-digit number
+static uint8_t LCD_bignum_f_digit[LCD_BIGNUM_COUNT];                 //Fractional digits of each big-digit number
+static uint8_t LCD_bignum_shown[LCD_BIGNUM_COUNT][LCD_BIGNUM_DIGITS];  //Symbol shown on each digit(0xFF if unknown)
+#endif
+
+#if LCD_FRAME_RATE > 0
+static char             LCD_frame_buffer[LCD_ROWS][LCD_COLUMNS];           //Characters of the frame
+static uint8_t          LCD_frame_dirty[LCD_ROWS][LCD_FRAME_DIRTY_BYTES];  //1 bit per cell, set if the cell changed
+static uint16_t         LCD_frame_ticks;                                   //Ticks passed in the current frame period
+static volatile uint8_t LCD_frame_due;                                     //Set when the frame period passes
+#endif
+
+#if LCD_ANIM_COUNT > 0
+static const char * volatile LCD_anim_frames[LCD_ANIM_COUNT];    //Patterns of all frames of each animation(NULL if stopped)
+static uint8_t               LCD_anim_location[LCD_ANIM_COUNT];  //CGRAM location each animation is played on
+static uint8_t               LCD_anim_count[LCD_ANIM_COUNT];     //Number of frames of each animation
+static uint8_t               LCD_anim_frame[LCD_ANIM_COUNT];     //Frame each animation is showing
+static uint16_t              LCD_anim_period[LCD_ANIM_COUNT];    //Ticks each frame is shown for
+static uint16_t              LCD_anim_ticks[LCD_ANIM_COUNT];     //Ticks passed since the last frame
+static volatile uint8_t      LCD_anim_due[LCD_ANIM_COUNT];       //Set when the next frame of the animation is due
+#endif
+
+#if LCD_USE_RW && LCD_FRAME_RATE > 0
+static char    LCD_glyph_pattern[8][8];  //Copy of the pattern of each custom character
+static uint8_t LCD_glyph_loaded;         //Bit of each custom character that has a pattern in "LCD_glyph_pattern"
+static uint8_t LCD_verify_row;           //Row to be checked next(rows after the last row are custom characters)
+static uint8_t LCD_verify_column;        //Column to be checked next
+#endif
 
+#if LCD_USE_UTF8 && LCD_UTF8_SLOTS > 0
+static const uint16_t *LCD_utf8_glyph_points;                 //Code points of the custom characters
+static const char     *LCD_utf8_glyph_patterns;               //Patterns of the custom characters
+static uint8_t         LCD_utf8_glyph_count;                  //Number of custom characters
+static uint16_t        LCD_utf8_slot_points[LCD_UTF8_SLOTS];  //Code point loaded into each CGRAM location(0 if none)
+static uint8_t         LCD_utf8_slot_next;                    //CGRAM location to be replaced next
+#endif
+
+#if LCD_QUEUE_SIZE > 0
+static volatile uint8_t LCD_queue_address[LCD_QUEUE_SIZE];    //DDRAM address(set command) of each queued character
+static volatile char    LCD_queue_character[LCD_QUEUE_SIZE];  //Queued characters
+static volatile uint8_t LCD_queue_head;                       //Number of queued characters(changed only by the poster)
+static volatile uint8_t LCD_queue_tail;                       //Number of written characters(changed only by "LCD_drain")
+#endif
+
+#if LCD_USE_BATCH
+static uint8_t  LCD_batch_open;        //1 between "LCD_batch_begin" and "LCD_batch_end"
+static uint8_t  LCD_batch_moved;       //1 if cursor moves are held back
+static uint8_t  LCD_batch_from;        //Address the cursor was at before the held moves
+static uint8_t  LCD_batch_lost;        //1 if the LCD isn't at "LCD_address"(in CGRAM or moved by reading)
+static uint8_t  LCD_batch_entry;       //Entry mode command the LCD has
+static uint8_t  LCD_batch_entry_held;  //Held entry mode command(0 if none)
+static int8_t   LCD_batch_shift;       //Held display shifts(+ left, - right)
+static uint8_t  LCD_batch_blank[16];   //Bits of the DDRAM addresses still empty since a clear in the batch
+static uint16_t LCD_batch_saved;       //Bytes left out in the current batch
+#endif
+
+#if LCD_TRACE_SIZE > 0
+static uint16_t LCD_trace_time[LCD_TRACE_SIZE];   //Timer value of each event("LCD_TIMER")
+static uint8_t  LCD_trace_event[LCD_TRACE_SIZE];  //Pins of each event(bits 0-3: D4-D7, bit 4: RS, bit 5: RW)
+static uint16_t LCD_trace_count;                  //Number of events in the trace(max. "LCD_TRACE_SIZE")
+static uint16_t LCD_trace_next;                   //Index the next event goes to
+static uint16_t LCD_trace_lost;                   //Events overwritten since the last dump(stops at 65535)
+#endif
+
+
+#if LCD_TRACE_SIZE > 0
+/**
+ * Records a bus event(a nibble latched by the "EN" pin) into the trace\n
+ * (Oldest events are overwritten when the trace is full)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param event: Bits 0-3: D4-D7, bit 4: RS, bit 5: RW
+ */
+void LCD_trace_record(uint8_t event){
+    
+    LCD_trace_time[LCD_trace_next]  = LCD_TIMER;
+    LCD_trace_event[LCD_trace_next] = event;
+    LCD_trace_next = (LCD_trace_next + 1) & (LCD_TRACE_SIZE - 1);
+    
+    /* Count the event, or the overwritten one if the trace is full(without going back to 0) */
+    if(LCD_trace_count < LCD_TRACE_SIZE) LCD_trace_count++;
+    else if(LCD_trace_lost != 0xFFFF)    LCD_trace_lost++;
+}
+#endif
 
 /**
  * Pulses the clock line of LCD\n
@@ -63,38 +231,306 @@ static uint8_t LCD_entry_mode      = LCD_CMD_ENTRY_MODE;
  */
 void LCD_pulse_clock(){
   
-  LCD_EN_LAT = 1;              //Set the "EN" pin
-  __delay_us(LCD_BUSY_DELAY);  //Give the required delay
-  LCD_EN_LAT = 0;              //Clear the "EN" pin
+  LCD_EN_LAT = 1;  //Set the "EN" pin
+  __delay_us(1);   //Give the required pulse width
+  LCD_EN_LAT = 0;  //Clear the "EN" pin
+  
+#if LCD_TRACE_SIZE > 0
+  LCD_trace_record( (uint8_t)((LCD_RS_LAT << 4) | (LCD_D7_LAT << 3) | (LCD_D6_LAT << 2) | (LCD_D5_LAT << 1) | LCD_D4_LAT) );
+#endif
 }
 
 /**
- * Sends an 8-bit command (in 4-bit mode)\n
+ * Sends an 8-bit value (in 4-bit mode) without changing the "RS" pin,
+ * shared by the command and data functions\n
+ * (Waits until the LCD finishes the previous command first, the delay
+ * of this one is only given by the next access)\n
  * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
- * @param command: 8-bit command to be sent
+ * @param value: 8-bit value to be sent
  */
-void LCD_write_command(char command){
+void LCD_write_byte(char value){
     
-    LCD_RS_LAT = 0; //Enter command mode
+    /*---------- Wait for the previous command to finish ----------*/
+    LCD_BUSY_WAIT();
     
     /*---------- Load higher order 4-bits ----------*/
-    LCD_D7_LAT = (command & 0b10000000) >> 7;
-    LCD_D6_LAT = (command & 0b01000000) >> 6;
-    LCD_D5_LAT = (command & 0b00100000) >> 5;
-    LCD_D4_LAT = (command & 0b00010000) >> 4;
+    LCD_D7_LAT = (value & 0b10000000) >> 7;
+    LCD_D6_LAT = (value & 0b01000000) >> 6;
+    LCD_D5_LAT = (value & 0b00100000) >> 5;
+    LCD_D4_LAT = (value & 0b00010000) >> 4;
     
     /*---------- Send a clock pulse ----------*/
     LCD_pulse_clock();
     
     /*---------- Load lower order 4-bits ----------*/
-    LCD_D7_LAT = (command & 0b00001000) >> 3;
-    LCD_D6_LAT = (command & 0b00000100) >> 2;
-    LCD_D5_LAT = (command & 0b00000010) >> 1;
-    LCD_D4_LAT = (command & 0b00000001)     ;
+    LCD_D7_LAT = (value & 0b00001000) >> 3;
+    LCD_D6_LAT = (value & 0b00000100) >> 2;
+    LCD_D5_LAT = (value & 0b00000010) >> 1;
+    LCD_D4_LAT = (value & 0b00000001)     ;
     
     /*---------- Send a clock pulse ----------*/
     LCD_pulse_clock();
+    
+    /*---------- Give(or record) the delay required by the command ----------*/
+    LCD_BUSY_SET(LCD_BUSY_SHORT);
+}
+
+#if LCD_TRACK_ADDRESS
+/**
+ * Moves the tracked DDRAM address by 1 the same way the LCD moves its
+ * address counter(line 1 and line 2 continue into each other)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param increment: Non-zero to increment, 0 to decrement
+ */
+void LCD_address_step(uint8_t increment){
+    
+    if(increment){
+        if(LCD_address == 0x27)      LCD_address = 0x40;  //End of line-1 continues from line-2
+        else if(LCD_address == 0x67) LCD_address = 0x00;  //End of line-2 continues from line-1
+        else                         LCD_address++;
+    }
+    else{
+        if(LCD_address == 0x40)      LCD_address = 0x27;  //Start of line-2 continues from line-1
+        else if(LCD_address == 0x00) LCD_address = 0x67;  //Start of line-1 continues from line-2
+        else                         LCD_address--;
+    }
+}
+#endif
+
+#if LCD_USE_BATCH
+/**
+ * Sends the commands held back by the batch(only the ones that still
+ * change something)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ */
+void LCD_batch_flush(){
+    
+    LCD_RS_LAT = 0; //Enter command mode(sent directly, "LCD_write_command" would hold them again)
+    
+    /*---------- Display shifts(the ones that cancel each other are left out) ----------*/
+    while(LCD_batch_shift > 0){
+        LCD_write_byte(LCD_CMD_SHIFT_LEFT);
+        LCD_batch_shift--;
+        LCD_batch_saved--;
+    }
+    while(LCD_batch_shift < 0){
+        LCD_write_byte(LCD_CMD_SHIFT_RIGHT);
+        LCD_batch_shift++;
+        LCD_batch_saved--;
+    }
+    
+    /*---------- Entry mode(only if it's different from the one the LCD has) ----------*/
+    if(LCD_batch_entry_held){
+        if(LCD_batch_entry_held != LCD_batch_entry){
+            LCD_write_byte(LCD_batch_entry_held);
+            LCD_batch_entry = LCD_batch_entry_held;
+            LCD_batch_saved--;
+        }
+        LCD_batch_entry_held = 0;
+    }
+    
+    /*---------- Cursor moves(one set address for all of them, if the cursor moved at all) ----------*/
+    if(LCD_batch_moved){
+        if(LCD_batch_lost || LCD_address != LCD_batch_from){
+            LCD_write_byte(LCD_CMD_DDRAM_SET | LCD_address);
+            LCD_batch_lost = 0;
+            LCD_batch_saved--;
+        }
+        LCD_batch_moved = 0;
+    }
+}
+
+/**
+ * Decides if a command can be held back inside a batch(and sends the
+ * held ones first if it can't)\n
+ * (Has to be called before the command changes the tracked address)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param code: Command to be sent
+ * @return 1 if the command is held back, 0 if it has to be sent now
+ */
+uint8_t LCD_batch_hold(uint8_t code){
+    
+    /*---------- Cursor moves(merged into one set address) ----------*/
+    if( (code & LCD_CMD_DDRAM_SET) || ((code & 0b11111000) == LCD_CMD_CURSOR_DECREMENT && (LCD_batch_moved || !LCD_batch_lost)) ){
+        if(!LCD_batch_moved){
+            LCD_batch_moved = 1;
+            LCD_batch_from  = LCD_address;
+        }
+        LCD_batch_saved++;
+        return 1;
+    }
+    
+    /*---------- Display shifts(added up) ----------*/
+    if(code == LCD_CMD_SHIFT_LEFT || code == LCD_CMD_SHIFT_RIGHT){
+        LCD_batch_shift += (code == LCD_CMD_SHIFT_LEFT) ? 1 : -1;
+        LCD_batch_saved++;
+        return 1;
+    }
+    
+    /*---------- Entry mode(only the last one counts) ----------*/
+    if((code & 0b11111100) == LCD_CMD_ENTRY_MODE){
+        LCD_batch_entry_held = code;
+        LCD_batch_saved++;
+        return 1;
+    }
+    
+    /*---------- Clear Display/Return Home(cancel the held shifts and moves) ----------*/
+    if(code == LCD_CMD_CLEAR || (code & 0b11111110) == LCD_CMD_RETURN_HOME){
+        LCD_batch_shift = 0;
+        LCD_batch_moved = 0;
+        LCD_batch_lost  = 0;
+        if(code == LCD_CMD_CLEAR){
+            LCD_batch_entry |= 0b00000010;                          //(Clear sets the entry mode to increment)
+            for(uint8_t i=0 ; i < 16 ; i++) LCD_batch_blank[i] = 0xFF;  //Every cell is empty
+        }
+        return 0;
+    }
+    
+    /*---------- Set CGRAM Address(the held moves don't matter anymore) ----------*/
+    if((code & 0b11000000) == LCD_CMD_CGRAM_SET){
+        LCD_batch_moved = 0;
+        LCD_batch_flush();
+        LCD_batch_lost = 1;
+        return 0;
+    }
+    
+    /*---------- Anything else ----------*/
+    LCD_batch_flush();
+    return 0;
+}
+
+/**
+ * Decides if a character can be left out inside a batch(and sends the
+ * held commands first if it can't)\n
+ * (Has to be called before the data changes the tracked address)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param data: Character to be written
+ * @return 1 if the character is left out, 0 if it has to be sent
+ * now(data mode is entered)
+ */
+uint8_t LCD_batch_data(char data){
+    
+    uint8_t bit = (uint8_t)(1 << (LCD_address & 7));  //Bit of the cell in "LCD_batch_blank"
+    
+    /*---------- An empty space on an empty cell is only a cursor move(not with the entry shift) ----------*/
+    if( data == ' ' && !LCD_batch_lost && !(LCD_mode & 0b00001000) && (LCD_batch_blank[LCD_address >> 3] & bit) ){
+        if(!LCD_batch_moved){
+            LCD_batch_moved = 1;
+            LCD_batch_from  = LCD_address;
+        }
+        LCD_batch_saved++;
+        return 1;
+    }
+    
+    /*---------- Otherwise bring the LCD up to date and mark the cell as written ----------*/
+    LCD_batch_flush();
+    if(!LCD_batch_lost) LCD_batch_blank[LCD_address >> 3] &= (uint8_t)~bit;
+    
+    LCD_RS_LAT = 1; //Enter data mode
+    return 0;
+}
+#endif
+
+/**
+ * Sends an 8-bit command (in 4-bit mode)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param command: 8-bit command to be sent
+ */
+void LCD_write_command(char command){
+    
+#if LCD_TRACK_ADDRESS || LCD_USE_PAGES
+    uint8_t code = (uint8_t)command;  //(Only needed by the tracking below)
+#endif
+    
+    /*---------- Send the command(unless a batch holds it back) ----------*/
+#if LCD_USE_BATCH
+    if( !LCD_batch_open || !LCD_batch_hold(code) )
+#endif
+    {
+        LCD_RS_LAT = 0; //Enter command mode
+        LCD_write_byte(command);
+    }
+    
+#if LCD_TRACK_ADDRESS
+    /*---------- Keep track of where the command leaves the cursor ----------*/
+    if(code & LCD_CMD_DDRAM_SET){                                     //Set DDRAM Address
+        LCD_address = code & 0b01111111;
+    }
+    else if(code == LCD_CMD_CLEAR || (code & 0b11111110) == LCD_CMD_RETURN_HOME){  //Clear Display/Return Home
+        LCD_address = 0;
+    }
+    else if((code & 0b11111000) == LCD_CMD_CURSOR_DECREMENT){         //Increment/Decrement Cursor
+        LCD_address_step(code & 0b00000100);
+    }
+#endif
+    
+#if LCD_USE_PAGES
+    /*---------- Keep track of where the display is shifted to(for the pages) ----------*/
+    if(code == LCD_CMD_CLEAR || (code & 0b11111110) == LCD_CMD_RETURN_HOME) LCD_shift = 0;
+    if(code == LCD_CMD_SHIFT_LEFT)  LCD_shift = (LCD_shift == 39) ? 0 : (LCD_shift + 1);
+    if(code == LCD_CMD_SHIFT_RIGHT) LCD_shift = (LCD_shift == 0) ? 39 : (LCD_shift - 1);
+#endif
+    
+#if LCD_QUEUE_SIZE > 0 && LCD_QUEUE_URGENT
+    /*---------- Keep track of whether the cursor is in CGRAM(for "LCD_preempt") ----------*/
+    if((code & 0b11000000) == LCD_CMD_CGRAM_SET) LCD_cgram = 1;
+    if((code & LCD_CMD_DDRAM_SET) || code == LCD_CMD_CLEAR || (code & 0b11111110) == LCD_CMD_RETURN_HOME) LCD_cgram = 0;
+#endif
+}
+
+/**
+ * Sets the entry mode to increment without display shift(if it isn't
+ * already) for the writes that have to go from left to right no matter
+ * how the entry mode is configured(CGRAM patterns, frame runs, fields...)\n
+ * (Has to be followed by "LCD_entry_restore" with the returned value)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @return Mode bits to be restored
+ */
+uint8_t LCD_entry_forward(){
+    
+    uint8_t mode = LCD_mode;
+    
+    if((mode & 0b00011000) != 0b00010000){
+        LCD_mode = (mode & 0b11100111) | 0b00010000;  //(Tracked address follows the new mode too)
+        LCD_write_command(LCD_ENTRY_MODE);
+    }
+    
+    return mode;
+}
+
+/**
+ * Puts back the entry mode changed by "LCD_entry_forward"\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param mode: Value returned by "LCD_entry_forward"
+ */
+void LCD_entry_restore(uint8_t mode){
+    
+    if(mode != LCD_mode){
+        LCD_mode = mode;
+        LCD_write_command(LCD_ENTRY_MODE);
+    }
+}
+
+#if LCD_QUEUE_SIZE > 0 && LCD_QUEUE_URGENT
+/**
+ * Sends the characters queued with "LCD_post_char"/"LCD_post_string" in
+ * the middle of a longer write, then puts the entry mode and the cursor
+ * back so the interrupted write continues from where it was\n
+ * (Called between the characters of every write when the queue isn't
+ * empty, does nothing while the cursor is in CGRAM)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ */
+void LCD_preempt(){
+    
+    /* Custom characters can't be interrupted(the cursor can't be put back into CGRAM) */
+    if(LCD_cgram) return;
+    
+    /* Send the queued characters("LCD_drain" restores the entry mode and the address of the interrupted write) */
+    LCD_drain();
+    
+    LCD_RS_LAT = 1; //Back to data mode for the rest of the interrupted write
 }
+#endif
 
 /**
  * Sends an 8-bit data (in 4-bit mode)\n
@@ -105,50 +541,171 @@ void LCD_write_data(char data){
 
     LCD_RS_LAT = 1; //Enter data mode
     
-    /*---------- Load higher order 4-bits ----------*/
-    LCD_D7_LAT = (data & 0b10000000) >> 7;
-    LCD_D6_LAT = (data & 0b01000000) >> 6;
-    LCD_D5_LAT = (data & 0b00100000) >> 5;
-    LCD_D4_LAT = (data & 0b00010000) >> 4;
+    /*---------- Send the data(unless a batch leaves it out) ----------*/
+#if LCD_USE_BATCH
+    if( !LCD_batch_open || !LCD_batch_data(data) )
+#endif
+    LCD_write_byte(data);
     
-    /*---------- Send a clock pulse ----------*/
-    LCD_pulse_clock();
+#if LCD_TRACK_ADDRESS
+    /*---------- Keep track of the address(moves with the entry mode) ----------*/
+    LCD_address_step(LCD_mode & 0b00010000);
+#endif
+
+#if LCD_QUEUE_SIZE > 0 && LCD_QUEUE_URGENT
+    /*---------- Let the queued characters through(at the byte boundary) ----------*/
+    if(LCD_queue_tail != LCD_queue_head) LCD_preempt();
+#endif
+}
+
+/**
+ * Converts an unsigned variable to decimal digits\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param *end: Pointer right after the last character of the
+ * buffer(digits are placed from right to left, max. 10 digits)
+ * @param variable: Variable to be converted
+ * @return Pointer to the first(most significant) digit
+ */
+char* LCD_convert_digits(char *end, uint32_t variable){
     
-    /*---------- Load lower order 4-bits ----------*/
-    LCD_D7_LAT = (data & 0b00001000) >> 3;
-    LCD_D6_LAT = (data & 0b00000100) >> 2;
-    LCD_D5_LAT = (data & 0b00000010) >> 1;
-    LCD_D4_LAT = (data & 0b00000001)     ;
+    /* Place the digits from right to left(do-while since even 0 has 1 digit) */
+    do{
+        *--end = (char)(variable%10) + '0';  //Place the digit(with character 0 as offset)
+        variable /= 10;                      //Shift the number to the right
+    }while(variable);
     
-    /*---------- Send a clock pulse ----------*/
-    LCD_pulse_clock();
+    return end;
 }
 
+#if LCD_USE_EXEC || LCD_FIELD_COUNT > 0
 /**
- * Initializes the LCD\n
- * <u>LCD configured as:</u>\n
- * - Function set: 4-bit, 2-line, 5x8 dots\n
- * - Display: On\n
- * - Cursor display: Off\n
- * - Cursor blink: Off\n
- * - Cursor on write: Increment, no shift\n
+ * Renders a (fixed-point) number right aligned into a number of
+ * characters, shared by the field and bytecode functions\n
+ * (If the value doesn't fit, the characters are filled with '*')\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param *text: Characters to be filled(not null terminated)
+ * @param width: Number of characters
+ * @param f_digit: How many digits of the value are fractional\n
+ * (e.g. with 1, value 234 will be rendered as "23.4")
+ * @param value: Value to be rendered
  */
-void LCD_init(){
+void LCD_format_fixed(char *text, uint8_t width, uint8_t f_digit, int32_t value){
     
-    //---------- Pin configurations ----------
-    LCD_RS_TRIS = 0; LCD_RS_LAT = 0;
-    LCD_EN_TRIS = 0; LCD_EN_LAT = 0;
-    LCD_D4_TRIS = 0; LCD_D4_LAT = 0;
-    LCD_D5_TRIS = 0; LCD_D5_LAT = 0;
-    LCD_D6_TRIS = 0; LCD_D6_LAT = 0;
-    LCD_D7_TRIS = 0; LCD_D7_LAT = 0;
+    char buffer[10];   //Buffer to hold the digits(max. 10 digits for 32-bit)
+    char *digits;      //Pointer to the first digit in the buffer
+    uint8_t count;     //Variable to hold the number of digits
+    uint8_t length;    //Total number of characters of the value
+    uint8_t position;  //Position to place the next character(from right to left)
+    
+    /*----- Turn negative numbers into positive(unsigned, so -2147483648 fits too) -----*/
+    uint32_t magnitude = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+    
+    /*---------- Convert the value into digits ----------*/
+    digits = LCD_convert_digits(buffer + sizeof(buffer), magnitude);
+    count  = (uint8_t)((buffer + sizeof(buffer)) - digits);
+    
+    /*---------- Calculate the total length(digits, leading '0' of "0.x", '.' and '-') ----------*/
+    length = count;
+    if(f_digit){
+        if(length <= f_digit) length = f_digit + 1;
+        length++;
+    }
+    if(value < 0) length++;
+    
+    /*---------- Render the value right aligned(or '*' if it doesn't fit) ----------*/
+    position = width;
+    if(length > width){
+        while(position) text[--position] = '*';
+    }
+    else{
+        for(uint8_t i=0 ; i < f_digit ; i++){                  //Place the fractional digits
+            text[--position] = count ? digits[--count] : '0';  //(with leading zeros if needed)
+        }
+        if(f_digit) text[--position] = '.';                    //Place the '.' character
+        do{                                                    //Place the integer digits
+            text[--position] = count ? digits[--count] : '0';  //(at least one digit)
+        }while(count);
+        if(value < 0) text[--position] = '-';                  //Place the sign
+        while(position) text[--position] = ' ';                //Fill the rest with empty spaces
+    }
+}
+#endif
+
+#if LCD_USE_RW
+/**
+ * Reads an 8-bit data or the busy flag and address (in 4-bit mode)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param rs: 1 to read data from the current address, 0 to read the
+ * busy flag(bit 7) and the current address(bits 0-6)
+ * @return 8-bit value read from the LCD
+ */
+uint8_t LCD_read_byte(uint8_t rs){
+    
+    uint8_t value;  //Variable to hold the value read
+    
+#if LCD_USE_BATCH
+    /* Bring the LCD up to date first(reading data moves the address without it being tracked) */
+    if(LCD_batch_open){
+        LCD_batch_flush();
+        if(rs) LCD_batch_lost = 1;
+    }
+#endif
+    
+    /* Reading data needs the previous command to be finished(the busy flag can be read anytime) */
+    if(rs){
+        LCD_BUSY_WAIT();
+    }
+    
+    /*---------- Turn the data pins into inputs and enter read mode ----------*/
+    LCD_D4_TRIS = 1; LCD_D5_TRIS = 1; LCD_D6_TRIS = 1; LCD_D7_TRIS = 1;
+    LCD_RS_LAT = rs;
+    LCD_RW_LAT = 1;
+    
+    /*---------- Read higher order 4-bits ----------*/
+    LCD_EN_LAT = 1;
+    __delay_us(1);
+    value = (uint8_t)( (LCD_D7_PORT << 7) | (LCD_D6_PORT << 6) | (LCD_D5_PORT << 5) | (LCD_D4_PORT << 4) );
+    LCD_EN_LAT = 0;
+    __delay_us(1);
+    
+    /*---------- Read lower order 4-bits ----------*/
+    LCD_EN_LAT = 1;
+    __delay_us(1);
+    value |= (uint8_t)( (LCD_D7_PORT << 3) | (LCD_D6_PORT << 2) | (LCD_D5_PORT << 1) | LCD_D4_PORT );
+    LCD_EN_LAT = 0;
+    
+#if LCD_TRACE_SIZE > 0
+    LCD_trace_record( (uint8_t)(0b00100000 | (rs << 4) | (value >> 4)) );
+    LCD_trace_record( (uint8_t)(0b00100000 | (rs << 4) | (value & 0b00001111)) );
+#endif
+    
+    /*---------- Go back to write mode and turn the data pins into outputs ----------*/
+    LCD_RW_LAT = 0;
+    LCD_D4_TRIS = 0; LCD_D5_TRIS = 0; LCD_D6_TRIS = 0; LCD_D7_TRIS = 0;
+    
+    /* Reading data moves the address just like writing, give(or record) the same delay */
+    if(rs) LCD_BUSY_SET(LCD_BUSY_SHORT);
+    
+    return value;
+}
+#endif
+
+/**
+ * Puts the LCD into 4-bit mode from any state(8-bit mode after power-up,
+ * or 4-bit mode with the nibbles out of step) and sends the settings\n
+ * (Display and entry mode are sent from the global mode variable, the
+ * screen and the cursor location are left as they are)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ */
+void LCD_sync(){
     
     //******************************************************************//
     //*** Sequence for "Initializing 4-bit interface" from datasheet ***//
     //******************************************************************//
     
-    //---------- Wait for more than 40ms ----------
-    __delay_ms(60);
+    //---------- Wait for the previous command to finish ----------
+    LCD_BUSY_WAIT();
+    LCD_RS_LAT = 0;
     
     //---------- Load 0b0011 in command mode ----------
     LCD_D7_LAT = 0; LCD_D6_LAT = 0; LCD_D5_LAT = 1; LCD_D4_LAT = 1;
@@ -168,17 +725,111 @@ void LCD_init(){
     //---------- Send a clock pulse ----------
     LCD_pulse_clock();
     
+    //---------- Wait for the command to finish ----------
+    __delay_us(LCD_BUSY_DELAY);
+    
     //---------- Load 0b0010 in command mode(4-bit mode start) ----------
     LCD_D7_LAT = 0; LCD_D6_LAT = 0; LCD_D5_LAT = 1; LCD_D4_LAT = 0;
     
     //---------- Send a clock pulse ----------
     LCD_pulse_clock();
     
+    //---------- Give(or record) the delay of the command ----------
+    LCD_BUSY_SET(LCD_BUSY_SHORT);
+    
     //---------- Configure important settings ----------
     LCD_write_command(LCD_CMD_FUNCTION_SET);  //Function Set(4-bit, 2 line, 5x8 dots)
-    LCD_write_command(LCD_display_control);   //Display On/Off Control(Display on, cursor off, blinking off)
-    LCD_write_command(LCD_entry_mode);        //Entry Mode Set(Increment, shift off)
-    LCD_clear();                              //Clear the display
+    LCD_write_command(LCD_DISPLAY_CONTROL);   //Display On/Off Control(current display, cursor and blinking bits)
+    LCD_write_command(LCD_ENTRY_MODE);        //Entry Mode Set(current increment and shift bits)
+}
+
+#if LCD_CALIBRATE && LCD_USE_RW && LCD_USE_TIMER
+/**
+ * Measures how long the LCD takes for a short command, a data write and
+ * clearing the screen by reading the busy flag, and gives these delays(+ the
+ * margin) to every command after it instead of the worst case ones\n
+ * (The address counter is updated about 4uS(tADD) after the busy flag
+ * clears, the margin has to stay above this, 25% of the usual 37uS does)\n
+ * (Called once by "LCD_init", the busy flag isn't read by the writes, so
+ * "R/W" can stay low afterwards)\n
+ * (If the LCD doesn't answer as expected the worst case delays are kept)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ */
+void LCD_calibrate(){
+    
+    static const char command[3] = {LCD_CMD_DDRAM_SET | LCD_RESYNC_PROBE, ' ', LCD_CMD_CLEAR};  //Short command, data(wiped by the clear), long command
+    uint8_t address[3] = {LCD_RESYNC_PROBE, LCD_RESYNC_PROBE - 1, 0};                          //Address expected after each command
+    uint16_t ticks[3];  //Measured delay of each command[timer ticks]
+    uint16_t start;     //Timer value when the command was sent
+    uint8_t value;      //Busy flag and address read from the LCD
+    uint32_t delay;     //Measured delay with the margin added[uS]
+    
+    /* The data write moves the address with the entry mode */
+    if(LCD_mode & 0b00010000) address[1] = LCD_RESYNC_PROBE + 1;
+    
+    for(uint8_t i = 0; i < 3; i++){
+        
+        /*---------- Send the command and note when it was sent ----------*/
+        if(i == 1) LCD_write_data(command[i]);
+        else       LCD_write_command(command[i]);
+        start = (uint16_t)(LCD_ready_at - LCD_BUSY_SHORT * LCD_TIMER_TICKS_PER_US);
+        
+        /*---------- Poll the busy flag until the command is finished ----------*/
+        do{
+            value = LCD_read_byte(0);
+            ticks[i] = (uint16_t)(LCD_TIMER - start);
+            if(ticks[i] > LCD_BUSY_TICKS_MAX) return;  //(No answer, keep the worst case delays)
+        }while(value & 0b10000000);
+        
+        /* A wrong address means the pins aren't read properly(e.g. "R/W" not connected) */
+        if( (value & 0b01111111) != address[i] ) return;
+    }
+    
+    /*---------- Add the margin(never go above the worst case delays) ----------*/
+    if(ticks[1] > ticks[0]) ticks[0] = ticks[1];  //(Short delay covers both the commands and the data writes)
+    delay = ( (uint32_t)ticks[0] * (100 + LCD_CALIBRATE_MARGIN) / 100 + LCD_TIMER_TICKS_PER_US - 1 ) / LCD_TIMER_TICKS_PER_US;
+    if(delay < LCD_BUSY_DELAY) LCD_busy_short = (uint16_t)delay;
+    
+    delay = ( (uint32_t)ticks[2] * (100 + LCD_CALIBRATE_MARGIN) / 100 + LCD_TIMER_TICKS_PER_US - 1 ) / LCD_TIMER_TICKS_PER_US;
+    if(delay > LCD_busy_short && delay < LCD_BUSY_DELAY + LCD_BUSY_DELAY_EXTENDED) LCD_busy_long = (uint16_t)(delay - LCD_busy_short);
+}
+#endif
+
+/**
+ * Initializes the LCD\n
+ * <u>LCD configured as:</u>\n
+ * - Function set: 4-bit, 2-line, 5x8 dots\n
+ * - Display: On\n
+ * - Cursor display: Off\n
+ * - Cursor blink: Off\n
+ * - Cursor on write: Increment, no shift\n
+ */
+void LCD_init(){
+    
+    //---------- Pin configurations ----------
+    LCD_RS_TRIS = 0; LCD_RS_LAT = 0;
+    LCD_EN_TRIS = 0; LCD_EN_LAT = 0;
+    LCD_D4_TRIS = 0; LCD_D4_LAT = 0;
+    LCD_D5_TRIS = 0; LCD_D5_LAT = 0;
+    LCD_D6_TRIS = 0; LCD_D6_LAT = 0;
+    LCD_D7_TRIS = 0; LCD_D7_LAT = 0;
+#if LCD_USE_RW
+    LCD_RW_TRIS = 0; LCD_RW_LAT = 0;
+#endif
+    
+    //---------- Wait for more than 40ms(power-up) ----------
+    __delay_ms(60);
+    
+    //---------- Switch to 4-bit mode and configure important settings ----------
+    LCD_sync();
+    
+#if LCD_CALIBRATE && LCD_USE_RW && LCD_USE_TIMER
+    //---------- Measure the delays of the LCD ----------
+    LCD_calibrate();
+    
+#endif
+    //---------- Clear the display ----------
+    LCD_clear();
  }
 
 /**
@@ -224,16 +875,16 @@ void LCD_cursor_decrement(){
  */
 void LCD_configure_lcd_display(uint8_t state){
     
-    /* Change the gobal display control variable accordingly */
+    /* Change the display control bits of the gobal mode variable accordingly */
     if(state){
-        LCD_display_control |= 0b00000100;
+        LCD_mode |= 0b00000100;
     }
     else{
-        LCD_display_control &= 0b11111011;
+        LCD_mode &= 0b11111011;
     }
     
     /* Send the new display control command */
-    LCD_write_command(LCD_display_control);
+    LCD_write_command(LCD_DISPLAY_CONTROL);
 }
 
 /**
@@ -242,16 +893,16 @@ void LCD_configure_lcd_display(uint8_t state){
  */
 void LCD_configure_cursor_display(uint8_t state){
     
-    /* Change the gobal display control variable accordingly */
+    /* Change the display control bits of the gobal mode variable accordingly */
     if(state){
-        LCD_display_control |= 0b00000010;
+        LCD_mode |= 0b00000010;
     }
     else{
-        LCD_display_control &= 0b11111101;
+        LCD_mode &= 0b11111101;
     }
     
     /* Send the new display control command */
-    LCD_write_command(LCD_display_control);
+    LCD_write_command(LCD_DISPLAY_CONTROL);
 }
 
 /** 
@@ -260,16 +911,16 @@ void LCD_configure_cursor_display(uint8_t state){
  */
 void LCD_configure_cursor_blink(uint8_t state){
     
-    /* Change the gobal display control variable accordingly */
+    /* Change the display control bits of the gobal mode variable accordingly */
     if(state){
-        LCD_display_control |= 0b00000001;
+        LCD_mode |= 0b00000001;
     }
     else{
-        LCD_display_control &= 0b11111110;
+        LCD_mode &= 0b11111110;
     }
     
     /* Send the new display control command */
-    LCD_write_command(LCD_display_control);
+    LCD_write_command(LCD_DISPLAY_CONTROL);
 }
 
 /**
@@ -280,11 +931,11 @@ void LCD_clear(){
     /* Send the clear command(automatically sets cursor to 1,1) */
     LCD_write_command(LCD_CMD_CLEAR);
     
-    /* Give the extended delay needed by the longer command */
-    __delay_us(LCD_BUSY_DELAY_EXTENDED);
+    /* Give(or record) the extended delay needed by the longer command */
+    LCD_BUSY_EXTEND(LCD_BUSY_LONG);
     
-    /* Re-send the entry mode, otherwise clear command resets the id to increment */
-    LCD_write_command(LCD_entry_mode);
+    /* Re-send the entry mode if it's decrement, otherwise clear command resets the id to increment */
+    if( !(LCD_mode & 0b00010000) ) LCD_write_command(LCD_ENTRY_MODE);
 }
 
 /**
@@ -295,8 +946,8 @@ void LCD_shift_reset(){
     /* Send the return home command(automatically sets cursor to 1,1) */
     LCD_write_command(LCD_CMD_RETURN_HOME);
     
-    /* Give the extended delay needed by the longer command */
-    __delay_us(LCD_BUSY_DELAY_EXTENDED);
+    /* Give(or record) the extended delay needed by the longer command */
+    LCD_BUSY_EXTEND(LCD_BUSY_LONG);
 }
 
 /**
@@ -321,22 +972,90 @@ void LCD_shift_right(){
     LCD_write_command(LCD_CMD_SHIFT_RIGHT);
 }
 
+#if LCD_USE_PAGES
+/**
+ * Sets the cursor to a location on a page, the page can be written
+ * while another page is on the screen\n
+ * (Each line of the LCD holds 40 characters, the ones that don't fit
+ * on the screen are used as "LCD_PAGE_COUNT" pages)\n
+ * <STRONG>Note: Writing past the last column of a page continues on
+ * the next page or line!</STRONG>
+ * @param page: Page to be written(0 to LCD_PAGE_COUNT-1)
+ * @param row: Row position of the cursor(1-2)
+ * @param column: Column position of the cursor(1 to LCD_COLUMNS)
+ */
+void LCD_page_cursor_set(uint8_t page, uint8_t row, uint8_t column){
+    
+    /* Pages are placed one after the other on the same lines */
+    LCD_cursor_set(row, column + page*LCD_COLUMNS);
+}
+
+/**
+ * Shows a page by shifting the display to it, the characters are
+ * already in the LCD so the switch is instant\n
+ * (Takes max. 20 shift commands, much less than clearing and
+ * rewriting the screen)\n
+ * (Pages are kept track of through the shift commands, "LCD_clear" and
+ * "LCD_shift_reset" go back to page 0. Don't use with the entry shift
+ * on, see "LCD_configure_entry_shift")
+ * @param page: Page to be shown(0 to LCD_PAGE_COUNT-1)
+ */
+void LCD_page_flip(uint8_t page){
+    
+    /* Find how many characters the display needs to move to the left */
+    uint8_t target = page * LCD_COLUMNS;
+    uint8_t steps  = (target >= LCD_shift) ? (target - LCD_shift) : (target + 40 - LCD_shift);
+    
+    /* Shift to the closer side(the line wraps around after 40 characters) */
+    if(steps <= 20){
+        while(steps--) LCD_write_command(LCD_CMD_SHIFT_LEFT);
+    }
+    else{
+        steps = 40 - steps;
+        while(steps--) LCD_write_command(LCD_CMD_SHIFT_RIGHT);
+    }
+}
+
+/**
+ * Clears a page without touching the others(e.g. before writing a page
+ * that is not on the screen)\n
+ * (Cursor will point to the right side of the page's last row)
+ * @param page: Page to be cleared(0 to LCD_PAGE_COUNT-1)
+ */
+void LCD_page_clear(uint8_t page){
+    
+    char spaces[LCD_COLUMNS];  //A row of empty characters
+    
+    for(uint8_t i=0 ; i < LCD_COLUMNS ; i++){
+        spaces[i] = ' ';
+    }
+    
+    /* Overwrite each row of the page(from left to right, see "LCD_entry_forward") */
+    uint8_t mode = LCD_entry_forward();
+    for(uint8_t row=1 ; row <= LCD_ROWS ; row++){
+        LCD_page_cursor_set(page, row, 1);
+        LCD_write_buffer(spaces, LCD_COLUMNS);
+    }
+    LCD_entry_restore(mode);
+}
+#endif
+
 /**
  * Configures if the cursor increments or decrements on a write command
  * @param state: 1 to increment, 0 to decrement
  */
 void LCD_configure_entry_id(uint8_t state){
     
-    /* Change the gobal entry mode variable accordingly */
+    /* Change the entry mode bits of the gobal mode variable accordingly */
     if(state){
-        LCD_entry_mode |= 0b00000010;
+        LCD_mode |= 0b00010000;
     }
     else{
-        LCD_entry_mode &= 0b11111101;
+        LCD_mode &= 0b11101111;
     }
     
     /* Send the new entry mode command */
-    LCD_write_command(LCD_entry_mode);
+    LCD_write_command(LCD_ENTRY_MODE);
 }
 
 /**
@@ -346,17 +1065,35 @@ void LCD_configure_entry_id(uint8_t state){
  */
 void LCD_configure_entry_shift(uint8_t state){
     
-    /* Change the gobal entry mode variable accordingly */
+    /* Change the entry mode bits of the gobal mode variable accordingly */
     if(state){
-        LCD_entry_mode |= 0b00000001;
+        LCD_mode |= 0b00001000;
     }
     else{
-        LCD_entry_mode &= 0b11111110;
+        LCD_mode &= 0b11110111;
     }
     
     /* Send the new entry mode command */
-    LCD_write_command(LCD_entry_mode);
+    LCD_write_command(LCD_ENTRY_MODE);
+}
+
+#if LCD_USE_RW && LCD_FRAME_RATE > 0
+/**
+ * Keeps a copy of the pattern of a custom character, so "LCD_verify" and
+ * "LCD_resync" can check and rewrite it even if the caller's pattern is
+ * gone(e.g. a buffer on the stack)\n
+ * <STRONG>(!!!Meant for internal use only!!!)</STRONG>
+ * @param *pattern: Binary pattern of the character
+ * @param address: CGRAM location of the character(0-7)
+ */
+void LCD_glyph_remember(const char *pattern, uint8_t address){
+    
+    for(uint8_t i=0 ; i < 8 ; i++){
+        LCD_glyph_pattern[address][i] = pattern[i];
+    }
+    LCD_glyph_loaded |= (uint8_t)(1 << address);
 }
+#endif
 
 /**
  * Adds a custom character to the "CGRAM" and resets cursor to 1,1\n
@@ -365,14 +1102,18 @@ void LCD_configure_entry_shift(uint8_t state){
  * (Character font needs to be 5x8!)
  * @param *pattern: Binary pattern of the character\n
  * (Can be generated by googling "LCD custom character
- * generator".)
+ * generator".)\n
+ * (Declare the pattern as "const" to keep it in program memory
+ * instead of RAM, it can be changed or go out of scope after the call)
  * @param location: CGRAM address to put the character(0-7)
  */
-void LCD_add_character(char *pattern, uint8_t address){
+void LCD_add_character(const char *pattern, uint8_t address){
     
     /* Set the CGRAM address with the passed offset(address).
      * Multiply the offset by 8(shift left by 3), since each
-     * "CGRAM location" has 8 addresses for 8 rows of character.*/  
+     * "CGRAM location" has 8 addresses for 8 rows of character.
+     * The rows go downwards, so the entry mode has to increment.*/  
+    uint8_t mode = LCD_entry_forward();
     LCD_write_command( LCD_CMD_CGRAM_SET + (uint8_t)(address<<3) );
 
     /* Send the pattern */
@@ -380,23 +1121,190 @@ void LCD_add_character(char *pattern, uint8_t address){
         LCD_write_data(pattern[i]);
     }
     
+#if LCD_USE_RW && LCD_FRAME_RATE > 0
+    /* Remember the pattern so "LCD_verify" can check it */
+    LCD_glyph_remember(pattern, address);
+#endif
+    
     /* Set cursor to 1,1 to point the cursor back from "CGRAM" to "DDRAM" */
+    LCD_entry_restore(mode);
     LCD_cursor_set(1, 1);
 }
 
+#if LCD_TRACK_ADDRESS
 /**
- * Writes a string to the current cursor location\n
- * <STRONG>!!!The string has to be null terminated otherwise this function will fail or loop forever!!!</STRONG> 
- * @param *string: Character array that contains the string(max. 255 characters)
+ * Changes a custom character in the "CGRAM" without moving the cursor\n
+ * (Characters already on screen that use this location change too)\n
+ * (Character font needs to be 5x8!)
+ * @param *pattern: Binary pattern of the character\n
+ * (Declare the pattern as "const" to keep it in program memory
+ * instead of RAM, it can be changed or go out of scope after the call)
+ * @param location: CGRAM address to put the character(0-7)
  */
-void LCD_write_string(char *string){
-   
-    /* Write all characters one by one until you reach "NULL" */
-    for(uint8_t i=0 ; string[i] != '\0' ; i++){
-        LCD_write_data(string[i]);
+void LCD_set_character(const char *pattern, uint8_t address){
+    
+    /* Save the cursor location(writing the pattern moves the tracked address) */
+    uint8_t cursor = LCD_address;
+    
+    /* Set the CGRAM address and send the pattern(see "LCD_add_character") */
+    uint8_t mode = LCD_entry_forward();
+    LCD_write_command( LCD_CMD_CGRAM_SET + (uint8_t)(address<<3) );
+    LCD_write_buffer(pattern, 8);
+    
+#if LCD_USE_RW && LCD_FRAME_RATE > 0
+    /* Remember the pattern so "LCD_verify" can check it */
+    LCD_glyph_remember(pattern, address);
+#endif
+    
+    /* Point the cursor back from "CGRAM" to the saved "DDRAM" address */
+    LCD_entry_restore(mode);
+    LCD_write_command(LCD_CMD_DDRAM_SET | cursor);
+}
+#endif
+
+/**
+ * Writes a number of characters to the current cursor location\n
+ * (The data mode is entered only once for the whole buffer, so
+ * this is the fastest way of writing multiple characters)\n
+ * (The buffer doesn't have to be null terminated)
+ * @param *buffer: Character array that contains the characters
+ * @param length: Number of characters to be written
+ */
+void LCD_write_buffer(const char *buffer, uint16_t length){
+    
+    LCD_RS_LAT = 1; //Enter data mode(once for all the characters)
+    
+    /* Send all characters one by one(keeping track of the address, letting the queued characters through) */
+    while(length--){
+#if LCD_USE_BATCH
+        if( !LCD_batch_open || !LCD_batch_data(*buffer) )
+#endif
+        LCD_write_byte(*buffer);
+        buffer++;
+#if LCD_TRACK_ADDRESS
+        LCD_address_step(LCD_mode & 0b00010000);
+#endif
+#if LCD_QUEUE_SIZE > 0 && LCD_QUEUE_URGENT
+        if(LCD_queue_tail != LCD_queue_head) LCD_preempt();
+#endif
     }
 }
 
+/**
+ * Writes a string to the current cursor location\n
+ * <STRONG>!!!The string has to be null terminated otherwise this function will fail or loop forever!!!</STRONG> 
+ * @param *string: Character array that contains the string(max. 65535 characters)\n
+ * (String literals and "const" arrays are read directly from program memory)
+ */
+void LCD_write_string(const char *string){
+   
+    uint16_t length = 0;  //Variable to hold the length of the string
+    
+    /* Count the characters until you reach "NULL" */
+    while(string[length] != '\0') length++;
+    
+    /* Write all characters at once */
+    LCD_write_buffer(string, length);
+}
+
+#if LCD_USE_PACKED
+/**
+ * Writes a text compressed by "lcd_strings"(in LCD Tools) to the current
+ * cursor location\n
+ * (The characters are sent as they are decoded, the text and the tokens
+ * are read directly from program memory, no RAM buffer is used)\n
+ * (A character costs the same as in "LCD_write_string", each token and
+ * each run of plain characters adds one "LCD_write_buffer" call)
+ * @param *text: Compressed text(e.g. LCD_texts[LCD_LANGUAGE_EN][LCD_TEXT_HELLO])
+ * @param *tokens: Token table generated together with the text(LCD_tokens)
+ */
+void LCD_write_packed(const char *text, const char * const *tokens){
+    
+    uint16_t length;  //Number of plain characters in a row
+    
+    while(*text != '\0'){
+        
+        /*---------- Write the plain characters in one go ----------*/
+        length = 0;
+        while( text[length] != '\0' && (uint8_t)text[length] < 0x80 && text[length] != LCD_PACKED_ESCAPE ) length++;
+        if(length){
+            LCD_write_buffer(text, length);
+            text += length;
+        }
+        
+        /*---------- Token(0x80 + token number): write the characters of the token ----------*/
+        if((uint8_t)*text >= 0x80){
+            LCD_write_string(tokens[(uint8_t)*text - 0x80]);
+            text++;
+        }
+        
+        /*---------- Escape: write the next byte as it is(characters 0x80-0xFF) ----------*/
+        else if(*text == LCD_PACKED_ESCAPE){
+            LCD_write_buffer(text + 1, 1);
+            text += 2;
+        }
+    }
+}
+#endif
+
+#if LCD_USE_TEXT
+/**
+ * Writes a text starting from the given location, wrapping onto the
+ * next row when the end of a row is reached\n
+ * (Rows follow the reading order(1-2-3-4) instead of the DDRAM order,
+ * the text continues from the first row after the last one)\n
+ * (A '\\n' character moves the text onto the next row)\n
+ * (The cursor location is only set at the start and on row changes)\n
+ * (The text goes from left to right whatever the entry mode is, the
+ * entry mode is put back after it)\n
+ * <STRONG>!!!The text has to be null terminated otherwise this function will fail or loop forever!!!</STRONG>
+ * @param *text: Character array that contains the text
+ * @param *row: Starting row position(1-4)\n
+ * (Updated to the row of the cursor after writing)
+ * @param *column: Starting column position(1-20)\n
+ * (Updated to the column of the cursor after writing, the cursor
+ * is left there so other write functions can follow without
+ * setting the cursor)
+ */
+void LCD_write_text(const char *text, uint8_t *row, uint8_t *column){
+    
+    uint8_t length;  //Number of characters to be written on the current row
+    uint8_t mode;    //Mode to be left at the end(the rows are written from left to right)
+    
+    /* Write from left to right(see "LCD_entry_forward") and set the starting cursor location */
+    mode = LCD_entry_forward();
+    LCD_cursor_set(*row, *column);
+    
+    while(1){
+        
+        /*---------- Count the characters that fit in the rest of the row ----------*/
+        length = 0;
+        while( text[length] != '\0' && text[length] != '\n' && length <= (LCD_COLUMNS - *column) ){
+            length++;
+        }
+        
+        /*---------- Write them at once ----------*/
+        LCD_write_buffer(text, length);
+        text    += length;
+        *column += length;
+        
+        /*---------- Decide whether to move onto the next row ----------*/
+        if(*text == '\n') text++;                     //Skip the new line character(also when the row is just full)
+        else if(*column <= LCD_COLUMNS) break;        //If the text ended before the end of the row, break
+        
+        /*---------- Move onto the next row(back to row 1 after the last row) ----------*/
+        *column = 1;
+        *row = (*row < LCD_ROWS) ? (*row + 1) : 1;
+        LCD_cursor_set(*row, *column);
+        
+        /*---------- If the text ended right at the end of the row, break ----------*/
+        if(*text == '\0') break;
+    }
+    
+    LCD_entry_restore(mode);
+}
+#endif
+
 /**
  * Writes an ASCII character to the current cursor location
  * @param character: Character to be written
@@ -407,6 +1315,126 @@ void LCD_write_char(char character){
     LCD_write_data(character);
 }
 
+#if LCD_USE_UTF8
+/* Code points that the ROM has(sorted) and the character codes they are at */
+#if LCD_CHARSET_A02
+static const uint16_t LCD_utf8_points[] = { 0x201C, 0x201D, 0x2190, 0x2191, 0x2192, 0x2193, 0x21B5, 0x2264,
+                                            0x2265, 0x2302, 0x25B2, 0x25B6, 0x25BC, 0x25C0, 0x25CF };
+static const char     LCD_utf8_codes[]  = { 0x12,   0x13,   0x1B,   0x18,   0x1A,   0x19,   0x17,   0x1C,
+                                            0x1D,   0x7F,   0x1E,   0x10,   0x1F,   0x11,   0x16 };
+#else
+static const uint16_t LCD_utf8_points[] = { 0x00A2, 0x00A5, 0x00B0, 0x00B5, 0x00B7, 0x00DF, 0x00E4, 0x00F1,
+                                            0x00F6, 0x00F7, 0x00FC, 0x03A3, 0x03A9, 0x03B1, 0x03B2, 0x03B5,
+                                            0x03B8, 0x03BC, 0x03C0, 0x03C1, 0x03C3, 0x2190, 0x2192, 0x221A,
+                                            0x221E, 0x2588 };
+static const char     LCD_utf8_codes[]  = { 0xEC,   0x5C,   0xDF,   0xE4,   0xA5,   0xE2,   0xE1,   0xEE,
+                                            0xEF,   0xFD,   0xF5,   0xF6,   0xF4,   0xE0,   0xE2,   0xE3,
+                                            0xF2,   0xE4,   0xF7,   0xE6,   0xE5,   0x7F,   0x7E,   0xE8,
+                                            0xF3,   0xFF };
+#endif
+
+/**
+ * Writes a UTF-8 encoded string to the current cursor location\n
+ * (ASCII characters are written as they are, others are written with
+ * their character code in the LCD's ROM(A00 or A02, see "LCD_CHARSET_A02"),
+ * or as a custom character given with "LCD_utf8_glyphs", or as '?')\n
+ * (Custom characters are loaded into the last "LCD_UTF8_SLOTS" CGRAM
+ * locations in turns, a string shouldn't use more different ones than that)\n
+ * <STRONG>!!!The string has to be null terminated otherwise this function will fail or loop forever!!!</STRONG>
+ * @param *string: Character array that contains the UTF-8 string
+ */
+void LCD_write_utf8(const char *string){
+    
+    uint16_t length;  //Length of the current run of ASCII characters
+    uint16_t point;   //Code point of the current character
+    uint8_t  code;    //Character code to be written(0 if not found yet)
+    
+    while(1){
+        
+        /*---------- Write the run of ASCII characters(0x01-0x7F) at once ----------*/
+        length = 0;
+        while( (uint8_t)(string[length] - 1) < 0x7F ) length++;
+        LCD_write_buffer(string, length);
+        string += length;
+        if(*string == '\0') break;
+        
+        /*---------- Decode the multi-byte character ----------*/
+        uint8_t lead   = (uint8_t)*string++;  //First byte tells the number of continuation bytes
+        uint8_t follow = 0;
+        point = 0;
+        if     ((lead & 0b11100000) == 0b11000000){ point = lead & 0b00011111; follow = 1; }
+        else if((lead & 0b11110000) == 0b11100000){ point = lead & 0b00001111; follow = 2; }
+        else if((lead & 0b11111000) == 0b11110000){ follow = 3; }  //(Outside 16-bits, can't be shown)
+        for( ; follow ; follow--){
+            if( ((uint8_t)*string & 0b11000000) != 0b10000000 ) break;  //Stop on a cut sequence
+            point = (uint16_t)(point << 6) | ((uint8_t)*string++ & 0b00111111);
+        }
+        if( follow || (lead & 0b11111000) == 0b11110000 || point < 0x80 ) point = 0xFFFF;  //Invalid
+        
+        /*---------- Look for the character in the ROM(binary search) ----------*/
+        uint8_t low  = 0;
+        uint8_t high = sizeof(LCD_utf8_points) / sizeof(LCD_utf8_points[0]);
+        while(low < high){
+            uint8_t middle = (low + high) >> 1;
+            if(LCD_utf8_points[middle] < point) low  = middle + 1;
+            else                                high = middle;
+        }
+        code = 0;
+        if(low < sizeof(LCD_utf8_points) / sizeof(LCD_utf8_points[0]) && LCD_utf8_points[low] == point){
+            code = (uint8_t)LCD_utf8_codes[low];
+        }
+        if(point >= LCD_UTF8_RANGE_FIRST && point <= LCD_UTF8_RANGE_LAST){
+            code = (uint8_t)(point - LCD_UTF8_RANGE_FIRST + LCD_UTF8_RANGE_CODE);
+        }
+        
+#if LCD_UTF8_SLOTS > 0
+        /*---------- If it's not in the ROM, look for it in the CGRAM ----------*/
+        for(uint8_t i=0 ; i < LCD_UTF8_SLOTS && !code ; i++){
+            if(LCD_utf8_slot_points[i] == point) code = (8 - LCD_UTF8_SLOTS) + i;
+        }
+        
+        /*---------- If it's not in the CGRAM either, load it from the custom characters ----------*/
+        for(uint8_t i=0 ; i < LCD_utf8_glyph_count && !code ; i++){
+            if(LCD_utf8_glyph_points[i] != point) continue;
+            uint8_t slot = LCD_utf8_slot_next;
+            LCD_utf8_slot_next = (slot + 1 < LCD_UTF8_SLOTS) ? (slot + 1) : 0;
+            LCD_set_character(LCD_utf8_glyph_patterns + (uint16_t)i * 8, (8 - LCD_UTF8_SLOTS) + slot);
+            LCD_utf8_slot_points[slot] = point;
+            code = (8 - LCD_UTF8_SLOTS) + slot;
+        }
+#endif
+        
+        /*---------- Write the character('?' if it can't be shown) ----------*/
+        LCD_write_data(code ? (char)code : '?');
+    }
+}
+
+#if LCD_UTF8_SLOTS > 0
+/**
+ * Gives the custom characters to be used by "LCD_write_utf8" for the
+ * characters that are missing in the LCD's ROM\n
+ * (Characters are loaded into the CGRAM only when they are written,
+ * using the last "LCD_UTF8_SLOTS" CGRAM locations in turns)
+ * @param *points: Unicode code points of the characters(e.g. 0x20AC for the euro sign)
+ * @param *patterns: Binary patterns of the characters, 8 bytes for each
+ * code point(see "LCD_add_character")
+ * @param count: Number of characters
+ */
+void LCD_utf8_glyphs(const uint16_t *points, const char *patterns, uint8_t count){
+    
+    /* Save the table */
+    LCD_utf8_glyph_points   = points;
+    LCD_utf8_glyph_patterns = patterns;
+    LCD_utf8_glyph_count    = count;
+    
+    /* Forget the characters loaded from the old table(0 is never a code point looked up here) */
+    for(uint8_t i=0 ; i < LCD_UTF8_SLOTS ; i++){
+        LCD_utf8_slot_points[i] = 0;
+    }
+}
+#endif
+#endif
+
 /**
  * Writes an integer variable to the current cursor location(max. 32-bit)\n
  * (Negative numbers will be treated as positive!)
@@ -421,79 +1449,1059 @@ void LCD_write_char(char character){
  */
 void LCD_write_variable(int32_t variable, uint8_t left_offset){
     
-    int32_t temp_variable;  //Temporary variable to work on
-    uint8_t digits = 0;     //Variable to hold the number of total digits
+    char buffer[10];  //Buffer to hold the digits(max. 10 digits for 32-bit)
+    char *digits;     //Pointer to the first digit in the buffer
+    uint8_t count;    //Variable to hold the number of total digits
+    
+    /*----- Turn negative numbers into positive(unsigned, so -2147483648 fits too) -----*/
+    uint32_t magnitude = (variable < 0) ? -(uint32_t)variable : (uint32_t)variable;
     
-    /*----- Turn negative numbers into positive -----*/
-    if(variable < 0) variable *= -1;
+    /*---------- Convert the variable into digits ----------*/
+    digits = LCD_convert_digits(buffer + sizeof(buffer), magnitude);
+    count  = (uint8_t)((buffer + sizeof(buffer)) - digits);
     
-    /*---------- Calculate the total digits ----------*/
-    temp_variable = variable;          //Copy the variable
-    while(1){                          //...
-        digits++;                      //Increment the digit(do first since even 0 will have 1 digit)
-        if(temp_variable < 10) break;  //If the number has 1 digit left, break
-        temp_variable /= 10;           //Shift the number to the right
+    /*---------- Give the offset before writing the variable ----------*/
+    while(1){
+        if(left_offset <= count) break;  //If the offset is equal to digits *or less*, break
+        LCD_write_data(' ');             //Put an empty space
+        left_offset--;                   //Decrement the offset
     }
     
+    /*---------- Write the variable on screen ----------*/
+    LCD_write_buffer(digits, count);
+}
+
+#if LCD_USE_HEX
+/* Characters of the hexadecimal digits(indexed by the nibble) */
+static const char LCD_hex_digits[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+/**
+ * Writes a variable in hexadecimal to the current cursor location(max. 32-bit)\n
+ * (e.g. 0x1A3 is written as "1A3", no "0x" is put before it)
+ * @param variable: Variable to be written
+ * @param left_offset: If the offset is bigger than the total digit
+ * count, the difference is filled before writing the variable\n
+ * (e.g. 2 for an 8-bit register, 8 for a 32-bit CAN ID)\n
+ * (Leave as 0 if you want the variable to be written as is)
+ * @param zero_pad: 1 to fill the offset with '0', 0 to fill it with empty spaces
+ */
+void LCD_write_hex(uint32_t variable, uint8_t left_offset, uint8_t zero_pad){
+    
+    char buffer[8];                        //Buffer to hold the digits(max. 8 digits for 32-bit)
+    char *end    = buffer + sizeof(buffer);
+    char *digits = end;                    //Pointer to the first digit in the buffer
+    uint8_t count;                         //Variable to hold the number of total digits
+    
+    /*---------- Convert the variable into digits(4-bits each, from right to left) ----------*/
+    do{
+        *--digits = LCD_hex_digits[variable & 0x0F];
+        variable >>= 4;
+    }while(variable);
+    
+    count = (uint8_t)(end - digits);
+    
     /*---------- Give the offset before writing the variable ----------*/
     while(1){
-        if(left_offset <= digits) break;  //If the offset is equal to digits *or less*, break
-        LCD_write_data(' ');              //Put an empty space
-        left_offset--;                    //Decrement the offset
+        if(left_offset <= count) break;        //If the offset is equal to digits *or less*, break
+        LCD_write_data(zero_pad ? '0' : ' ');  //Fill the offset
+        left_offset--;                         //Decrement the offset
     }
     
     /*---------- Write the variable on screen ----------*/
+    LCD_write_buffer(digits, count);
+}
+
+/**
+ * Writes a variable in binary to the current cursor location(max. 32-bit)\n
+ * (e.g. 5 is written as "101", no "0b" is put before it)
+ * @param variable: Variable to be written
+ * @param left_offset: If the offset is bigger than the total digit
+ * count, the difference is filled before writing the variable\n
+ * (e.g. 8 for an 8-bit register)\n
+ * (Leave as 0 if you want the variable to be written as is)
+ * @param zero_pad: 1 to fill the offset with '0', 0 to fill it with empty spaces
+ */
+void LCD_write_bin(uint32_t variable, uint8_t left_offset, uint8_t zero_pad){
+    
+    char buffer[32];                       //Buffer to hold the digits(max. 32 digits for 32-bit)
+    char *end    = buffer + sizeof(buffer);
+    char *digits = end;                    //Pointer to the first digit in the buffer
+    uint8_t count;                         //Variable to hold the number of total digits
+    
+    /*---------- Convert the variable into digits(1-bit each, from right to left) ----------*/
+    do{
+        *--digits = (char)('0' + (variable & 1));
+        variable >>= 1;
+    }while(variable);
+    
+    count = (uint8_t)(end - digits);
+    
+    /*---------- Give the offset before writing the variable ----------*/
     while(1){
-        temp_variable = variable;                    //Copy/re-copy the variable
-        for(uint8_t i = 1 ; i < digits ; i++){       //Shift the temporary variable *digits* times
-            temp_variable /= 10;                     //...
-        }                                            //...
-        LCD_write_data( (temp_variable%10) + '0' );  //Write the digit(with character 0 as offset)
-        digits --;                                   //Decrement the *digits*(to move onto next)
-        if(digits == 0) break;                       //If *digits* reaches 0, break
+        if(left_offset <= count) break;        //If the offset is equal to digits *or less*, break
+        LCD_write_data(zero_pad ? '0' : ' ');  //Fill the offset
+        left_offset--;                         //Decrement the offset
     }
+    
+    /*---------- Write the variable on screen ----------*/
+    LCD_write_buffer(digits, count);
 }
+#endif
+
+#if LCD_USE_FLOAT
 
 /**
- * Writes a float variable to the current cursor location\n
- * (Negative numbers will be treated as positive!)
+ * Writes a float variable to the current cursor location, rounded to
+ * "f_digit" fractional digits(same digits as printf("%.*f"))\n
+ * (Values that don't fit into 32-bits(above 4294967295) are written as '*')
  * @param variable: Variable to be written
- * @param back_offset: If the offset is bigger than the total
- * digit count(including integer digits, float digits and 1 
- * more for the '.' character), the difference amount of 
- * empty spaces will be put before writing the variable\n
+ * @param left_offset: If the offset is bigger than the total
+ * character count(including '-', integer digits, '.' and float
+ * digits), the difference amount of empty spaces will be put
+ * before writing the variable\n
  * (Allows for right to left writing while keeping the first
  * digit stationary)\n
  * @param f_digit: How many digits of the fractional part to
- * be written\n
- * (Too high value will cause the variable to overflow!)
+ * be written(max. 9, 0 to write no '.' either)
  */
 void LCD_write_float(float variable, uint8_t left_offset, uint8_t f_digit){
     
-    /*----- Calculate the left offset for the integer part.(-1 is for the '.' character) -----*/
-    /*----- (Making sure that left offset doesn't wrap back to 255.) -----*/
-    if( left_offset >= (f_digit+1) ){        
-        left_offset = (left_offset-f_digit) - 1;
+    char buffer[21];                     //Buffer to hold the characters('-', 10 integer digits, '.', 9 float digits)
+    char *end = buffer + sizeof(buffer);
+    char *digits;                        //Pointer to the first character in the buffer
+    uint8_t count;                       //Variable to hold the number of total characters
+    
+    /*----- Turn negative numbers into positive(the sign is written at the end) -----*/
+    float magnitude = (variable < 0) ? -variable : variable;
+    if( !(magnitude < 4294967296.0f) ){  //(Also catches NaN)
+        LCD_write_data('*');
+        return;
+    }
+    if(f_digit > 9) f_digit = 9;
+    
+    /*----- Separate the integer part and the fraction as a 0.64 fixed-point number(all exact, no rounding) -----*/
+    uint32_t integer = (uint32_t)magnitude;
+    float    shifted = (magnitude - (float)integer) * 4294967296.0f;  //Fraction shifted left by 32 bits
+    uint32_t upper   = (uint32_t)shifted;                             //Bits 1-32 of the fraction
+    shifted          = (shifted - (float)upper) * 4294967296.0f;      //Rest shifted left by 32 bits
+    uint32_t lower   = (uint32_t)shifted;                             //Bits 33-64 of the fraction
+    uint8_t  sticky  = (shifted != (float)lower);                     //1 if there are more bits below
+    uint16_t part[4] = { (uint16_t)lower, (uint16_t)(lower >> 16), (uint16_t)upper, (uint16_t)(upper >> 16) };
+    
+    /*----- Turn the fraction into a scaled integer, one decimal digit at a time -----*/
+    uint32_t scaled = 0;  //Fractional digits as an integer
+    uint32_t limit  = 1;  //10^f_digit
+    for(uint8_t i=0 ; i < f_digit ; i++){
+        uint32_t carry = 0;
+        for(uint8_t j=0 ; j < 4 ; j++){            //Multiply the fraction by 10(16-bits at a time)...
+            carry   = (uint32_t)part[j]*10 + carry;
+            part[j] = (uint16_t)carry;
+            carry >>= 16;
+        }
+        scaled = scaled*10 + carry;               //...the part that moves above the point is the next digit
+        limit *= 10;
+    }
+    
+    /*----- Round to the nearest(ties to even like printf), carrying into the integer part -----*/
+    uint8_t above = (part[2] | part[1] | part[0]) || sticky;  //1 if the rest is more than its top 16 bits
+    uint8_t odd   = (uint8_t)((f_digit ? scaled : integer) & 1);
+    if( part[3] > 0x8000 || (part[3] == 0x8000 && (above || odd)) ){
+        if(++scaled == limit){
+            scaled = 0;
+            integer++;
+        }
+    }
+    
+    /*----- Place the characters from right to left -----*/
+    digits = end;
+    if(f_digit){
+        digits = LCD_convert_digits(digits, scaled);
+        while(end - digits < f_digit) *--digits = '0';  //Leading zeros of the fractional part
+        *--digits = '.';
+    }
+    digits = LCD_convert_digits(digits, integer);
+    if( ((const uint8_t*)&variable)[sizeof(float)-1] & 0x80 ) *--digits = '-';  //(Sign bit, so -0.0 is "-0" like printf)
+    count = (uint8_t)(end - digits);
+    
+    /*----- Give the offset before writing the variable -----*/
+    while(left_offset > count){
+        LCD_write_data(' ');
+        left_offset--;
+    }
+    
+    /*----- Write everything at once -----*/
+    LCD_write_buffer(digits, count);
+}
+
+#endif
+
+#if LCD_USE_EXEC
+/**
+ * Runs a screen program(bytecode), e.g. a whole static screen with its
+ * custom characters, in one call\n
+ * (A program is a list of "LCD_OP_..." opcodes(see "LCD.h"), each
+ * followed by its operands, that ends with "LCD_OP_END")\n
+ * (Declare the program as "const" to keep it in program memory
+ * instead of RAM)\n
+ * (The characters are written from left to right whatever the entry mode
+ * is, the entry bits of "LCD_OP_CONFIG" take effect after the program)\n
+ * <u>Example:</u>\n
+ * const uint8_t screen[] = { LCD_OP_CLEAR, LCD_OP_WRITE, 5, 'T','e','m','p',':',\n
+ *                            LCD_OP_ADDRESS, LCD_AT(2,1), LCD_OP_VALUE, 0, 6, 1, LCD_OP_END };\n
+ * LCD_exec(screen, values);
+ * @param *program: Bytecode to be run
+ * @param *values: Live values written by "LCD_OP_VALUE"(fixed-point, can
+ * be NULL if the program doesn't have any)
+ */
+void LCD_exec(const uint8_t *program, const int32_t *values){
+    
+    char text[12];    //Characters of a value(max. '-', 10 digits and '.')
+    uint8_t opcode;   //Current opcode
+    uint8_t count;    //Number of characters of the current opcode
+    uint8_t mode;     //Mode to be left at the end(the addresses in the program count upwards)
+    
+    mode = LCD_entry_forward();
+    
+    while(1){
+        
+        opcode = *program++;
+        
+        if(opcode == LCD_OP_ADDRESS){                              //Set the cursor
+            LCD_write_command(LCD_CMD_DDRAM_SET | *program++);
+        }
+        else if(opcode == LCD_OP_WRITE){                           //Write the characters that follow
+            count = *program++;
+            LCD_write_buffer((const char*)program, count);
+            program += count;
+        }
+        else if(opcode == LCD_OP_FILL){                            //Write the same character "count" times
+            count = *program++;
+            while(count--) LCD_write_data((char)*program);
+            program++;
+        }
+        else if(opcode == LCD_OP_GLYPH){                           //Change a custom character
+            LCD_set_character((const char*)program + 1, *program);
+            program += 9;
+        }
+        else if(opcode == LCD_OP_CONFIG){                          //Set the display bits(entry bits at the end)
+            mode = *program++;
+            LCD_mode = (mode & 0b11100111) | 0b00010000;
+            LCD_write_command(LCD_DISPLAY_CONTROL);
+        }
+        else if(opcode == LCD_OP_CLEAR){                           //Clear the screen
+            LCD_clear();
+        }
+        else if(opcode == LCD_OP_VALUE){                           //Write a live value
+            count = program[1];
+            if(count > sizeof(text)) count = sizeof(text);
+            LCD_format_fixed(text, count, program[2], values[program[0]]);
+            LCD_write_buffer(text, count);
+            program += 3;
+        }
+        else{                                                      //LCD_OP_END(or an unknown opcode)
+            LCD_entry_restore(mode);
+            return;
+        }
+    }
+}
+#endif
+
+#if LCD_FIELD_COUNT > 0
+
+/**
+ * Declares a display field that shows a (fixed-point) number at a fixed
+ * location\n
+ * (The field is repainted with "LCD_field_set", only the characters
+ * that changed since the last call are sent to the LCD)\n
+ * (Max. "LCD_FIELD_COUNT" fields can be declared at a time)
+ * @param id: Field number(0 to LCD_FIELD_COUNT-1)
+ * @param row: Row position of the field(1-4)
+ * @param column: Column position of the field's first character(1-20)
+ * @param width: Width of the field in characters(max. LCD_FIELD_WIDTH)\n
+ * (The number is written right aligned inside the field)
+ * @param f_digit: How many digits of the value are fractional\n
+ * (e.g. with 1, value 234 will be shown as "23.4")
+ */
+void LCD_field_add(uint8_t id, uint8_t row, uint8_t column, uint8_t width, uint8_t f_digit){
+    
+    /* Limit the width to the space reserved for each field */
+    if(width > LCD_FIELD_WIDTH) width = LCD_FIELD_WIDTH;
+    
+    /* Save the field's format */
+    LCD_field_row[id]     = row;
+    LCD_field_column[id]  = column;
+    LCD_field_width[id]   = width;
+    LCD_field_f_digit[id] = f_digit;
+    
+    /* Forget the last rendered characters so the first "LCD_field_set" paints the whole field.
+     * (0 is never rendered by a field, so every character will be different.) */
+    for(uint8_t i=0 ; i < LCD_FIELD_WIDTH ; i++){
+        LCD_field_text[id][i] = 0;
+    }
+}
+
+/**
+ * Shows a new value on a display field declared with "LCD_field_add"\n
+ * (Only the characters that differ from the last shown value are
+ * written, e.g. 23.4 -> 23.5 costs 1 cursor set and 1 character)\n
+ * (If the value doesn't fit, the field is filled with '*')\n
+ * (Cursor will point to the right side of the last changed character)
+ * @param id: Field number(0 to LCD_FIELD_COUNT-1)
+ * @param value: Value to be shown(fixed-point, scaled by the field's f_digit)
+ */
+void LCD_field_set(uint8_t id, int32_t value){
+    
+    char text[LCD_FIELD_WIDTH];  //New characters of the field
+    uint8_t width = LCD_field_width[id];
+    uint8_t mode  = LCD_mode;    //Entry mode to be restored
+    
+    /*---------- Render the value right aligned(or '*' if it doesn't fit) ----------*/
+    LCD_format_fixed(text, width, LCD_field_f_digit[id], value);
+    
+    /*---------- Write only the runs of characters that changed ----------*/
+    for(uint8_t i=0 ; i < width ; i++){
+        
+        if(text[i] == LCD_field_text[id][i]) continue;  //Skip the unchanged characters
+        
+        uint8_t start = i;                              //Find the end of the changed run
+        while(i < width && text[i] != LCD_field_text[id][i]){
+            LCD_field_text[id][i] = text[i];            //Remember the new character
+            i++;
+        }
+        
+        if(mode == LCD_mode) mode = LCD_entry_forward();  //(Runs are written from left to right)
+        LCD_cursor_set(LCD_field_row[id], LCD_field_column[id] + start);
+        LCD_write_buffer(text + start, i - start);
+    }
+    LCD_entry_restore(mode);
+}
+
+#endif
+
+#if LCD_BIGNUM_COUNT > 0
+
+/* Patterns of the custom characters the big digits are built from */
+static const char LCD_bignum_glyphs[LCD_BIGNUM_GLYPHS][8] = {
+    { 0b11111, 0b11111, 0b11111, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 },  //Bar at the top
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b11111, 0b11111, 0b11111 },  //Bar at the bottom
+    { 0b11111, 0b11111, 0b11111, 0b00000, 0b00000, 0b11111, 0b11111, 0b11111 },  //Bars at the top and the bottom
+#if LCD_CHARSET_A02
+    { 0b11111, 0b11111, 0b11111, 0b11111, 0b11111, 0b11111, 0b11111, 0b11111 }   //Full block
+#endif
+};
+
+/* Characters of each symbol(0-9, '-', empty), 3 columns for each row */
+#if LCD_BIGNUM_ROWS == 4
+static const char LCD_bignum_font[12][4][3] = {
+    { {LCD_BIG_FU, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU} },  //0
+    { {LCD_BIG_UP, LCD_BIG_FU, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_FU, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_FU, LCD_BIG_NO}, {LCD_BIG_LO, LCD_BIG_FU, LCD_BIG_LO} },  //1
+    { {LCD_BIG_UP, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_LO} },  //2
+    { {LCD_BIG_UP, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU} },  //3
+    { {LCD_BIG_FU, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU} },  //4
+    { {LCD_BIG_FU, LCD_BIG_UP, LCD_BIG_UP}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_LO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU} },  //5
+    { {LCD_BIG_FU, LCD_BIG_UP, LCD_BIG_UP}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_LO}, {LCD_BIG_FU, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU} },  //6
+    { {LCD_BIG_UP, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU} },  //7
+    { {LCD_BIG_FU, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU} },  //8
+    { {LCD_BIG_FU, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU} },  //9
+    { {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_LO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO} },  //-
+    { {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO} }   //Empty
+};
+#else
+static const char LCD_bignum_font[12][2][3] = {
+    { {LCD_BIG_FU, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU} },  //0
+    { {LCD_BIG_UP, LCD_BIG_FU, LCD_BIG_NO}, {LCD_BIG_LO, LCD_BIG_FU, LCD_BIG_LO} },  //1
+    { {LCD_BIG_UL, LCD_BIG_UL, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_LO} },  //2
+    { {LCD_BIG_UL, LCD_BIG_UL, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU} },  //3
+    { {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU} },  //4
+    { {LCD_BIG_FU, LCD_BIG_UL, LCD_BIG_UL}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU} },  //5
+    { {LCD_BIG_FU, LCD_BIG_UL, LCD_BIG_UL}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU} },  //6
+    { {LCD_BIG_UP, LCD_BIG_UP, LCD_BIG_FU}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_FU} },  //7
+    { {LCD_BIG_FU, LCD_BIG_UL, LCD_BIG_FU}, {LCD_BIG_FU, LCD_BIG_LO, LCD_BIG_FU} },  //8
+    { {LCD_BIG_FU, LCD_BIG_UL, LCD_BIG_FU}, {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_FU} },  //9
+    { {LCD_BIG_LO, LCD_BIG_LO, LCD_BIG_LO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO} },  //-
+    { {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO}, {LCD_BIG_NO, LCD_BIG_NO, LCD_BIG_NO} }   //Empty
+};
+#endif
+
+/**
+ * Declares a number that is shown with big digits(3 columns wide and
+ * "LCD_BIGNUM_ROWS" rows high) at a fixed location\n
+ * (Loads the 3 custom characters the digits are built from into the
+ * CGRAM, starting from "LCD_BIGNUM_GLYPH", plus a full block with
+ * "LCD_CHARSET_A02" since that ROM doesn't have one)\n
+ * (The number is repainted with "LCD_bignum_set", only the digits that
+ * changed since the last call are sent to the LCD. Call this again to
+ * repaint all digits, e.g. after "LCD_clear")\n
+ * (Max. "LCD_BIGNUM_COUNT" numbers can be declared at a time)
+ * @param id: Number's id(0 to LCD_BIGNUM_COUNT-1)
+ * @param row: Top row of the digits(1-4)
+ * @param column: Left column of the first digit(1-20)
+ * @param digits: Number of big digits(max. LCD_BIGNUM_DIGITS)\n
+ * (Takes digits*4-1 columns, digits are separated by an empty column)
+ * @param f_digit: How many digits of the value are fractional\n
+ * (The decimal point is shown in the empty column before them)
+ */
+void LCD_bignum_add(uint8_t id, uint8_t row, uint8_t column, uint8_t digits, uint8_t f_digit){
+    
+    /* Limit the digits to the space reserved for each number */
+    if(digits > LCD_BIGNUM_DIGITS) digits = LCD_BIGNUM_DIGITS;
+    
+    /* Save the number's format */
+    LCD_bignum_row[id]     = row;
+    LCD_bignum_column[id]  = column;
+    LCD_bignum_digits[id]  = digits;
+    LCD_bignum_f_digit[id] = f_digit;
+    
+    /* Load the custom characters(without moving the cursor) */
+    for(uint8_t i=0 ; i < LCD_BIGNUM_GLYPHS ; i++){
+        LCD_set_character(LCD_bignum_glyphs[i], LCD_BIGNUM_GLYPH + i);
+    }
+    
+    /* Forget the shown digits so the first "LCD_bignum_set" paints all of them */
+    for(uint8_t i=0 ; i < LCD_BIGNUM_DIGITS ; i++){
+        LCD_bignum_shown[id][i] = 0xFF;
+    }
+}
+
+/**
+ * Shows a new value on a big-digit number declared with "LCD_bignum_add"\n
+ * (Only the digits that differ from the last shown value are written,
+ * e.g. 123 -> 124 costs 1 cursor set and 4 characters for each row)\n
+ * (If the value doesn't fit, all digits show '-')\n
+ * (Cursor will point to the right side of the last changed digit's bottom row)
+ * @param id: Number's id(0 to LCD_BIGNUM_COUNT-1)
+ * @param value: Value to be shown(fixed-point, scaled by the number's f_digit)
+ */
+void LCD_bignum_set(uint8_t id, int32_t value){
+    
+    uint8_t symbol[LCD_BIGNUM_DIGITS];  //New symbol of each digit(0-9, LCD_BIGNUM_MINUS or LCD_BIGNUM_BLANK)
+    char text[LCD_BIGNUM_DIGITS*4];     //Characters of one row of the changed digits
+    char buffer[10];                    //Buffer to hold the digits(max. 10 digits for 32-bit)
+    char *digits;                       //Pointer to the first digit in the buffer
+    uint8_t count;                      //Variable to hold the number of digits
+    uint8_t length;                     //Total number of symbols of the value
+    uint8_t position;                   //Position to place the next symbol(from right to left)
+    uint8_t width   = LCD_bignum_digits[id];
+    uint8_t f_digit = LCD_bignum_f_digit[id];
+    uint8_t mode    = LCD_mode;             //Entry mode to be restored
+    
+    /*----- Turn negative numbers into positive(unsigned, so -2147483648 fits too) -----*/
+    uint32_t magnitude = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+    
+    /*---------- Convert the value into digits ----------*/
+    digits = LCD_convert_digits(buffer + sizeof(buffer), magnitude);
+    count  = (uint8_t)((buffer + sizeof(buffer)) - digits);
+    
+    /*---------- Calculate the total length(digits, leading '0' of "0.x" and '-') ----------*/
+    length = count;
+    if(length <= f_digit) length = f_digit + 1;
+    if(value < 0) length++;
+    
+    /*---------- Place the symbols right aligned(or '-' if it doesn't fit) ----------*/
+    position = width;
+    if(length > width){
+        while(position) symbol[--position] = LCD_BIGNUM_MINUS;
     }
     else{
-        left_offset = 0;
+        for(uint8_t i=0 ; i < f_digit ; i++){                                //Place the fractional digits
+            symbol[--position] = count ? (uint8_t)(digits[--count] - '0') : 0;  //(with leading zeros if needed)
+        }
+        do{                                                                  //Place the integer digits
+            symbol[--position] = count ? (uint8_t)(digits[--count] - '0') : 0;  //(at least one digit)
+        }while(count);
+        if(value < 0) symbol[--position] = LCD_BIGNUM_MINUS;                 //Place the sign
+        while(position) symbol[--position] = LCD_BIGNUM_BLANK;               //Fill the rest with empty digits
     }
     
-    /*----- Turn negative numbers into positive -----*/
-    if(variable < 0) variable *= -1;
+    /*---------- Write only the runs of digits that changed ----------*/
+    for(uint8_t i=0 ; i < width ; i++){
+        
+        if(symbol[i] == LCD_bignum_shown[id][i]) continue;  //Skip the unchanged digits
+        
+        uint8_t start = i;                                  //Find the end of the changed run
+        while(i < width && symbol[i] != LCD_bignum_shown[id][i]){
+            LCD_bignum_shown[id][i] = symbol[i];            //Remember the new symbol
+            i++;
+        }
+        
+        /* Write the run row by row, each digit with the empty column on its left(except the first digit) */
+        if(mode == LCD_mode) mode = LCD_entry_forward();  //(Rows are written from left to right)
+        for(uint8_t r=0 ; r < LCD_BIGNUM_ROWS ; r++){
+            length = 0;
+            for(uint8_t d=start ; d < i ; d++){
+                if(d) text[length++] = (d == width - f_digit && r == LCD_BIGNUM_ROWS - 1) ? '.' : ' ';
+                text[length++] = LCD_bignum_font[symbol[d]][r][0];
+                text[length++] = LCD_bignum_font[symbol[d]][r][1];
+                text[length++] = LCD_bignum_font[symbol[d]][r][2];
+            }
+            LCD_cursor_set(LCD_bignum_row[id] + r, LCD_bignum_column[id] + start*4 - (start ? 1 : 0));
+            LCD_write_buffer(text, length);
+        }
+    }
+    LCD_entry_restore(mode);
+}
+
+#endif
 
-    /*----- Seperate the integer and fractional parts using "modff" from "math.h" -----*/
-    float integer;                           //Define a variable for the integer part
-    float fractional;                        //Define a variable for the fractional part
-    fractional = modff(variable, &integer);  //Seperate the integer and fractional parts
+#if LCD_FRAME_RATE > 0 || LCD_ANIM_COUNT > 0
 
-    /*----- Write the integer part -----*/
-    LCD_write_variable( (int32_t)integer, left_offset );  //Write the integer part with given offset    
-    LCD_write_char('.');                                  //Place a dot before the fractional part
+/**
+ * Time base of the library, has to be called periodically(e.g. from a
+ * timer interrupt) at "LCD_TICK_RATE" times per second\n
+ * (Only needed when the frame functions or the animations are used)
+ */
+void LCD_tick(){
     
-    /*----- Write the fractional part -----*/
-    for(uint8_t i=0 ; i < f_digit ; i++){                           //Limit the fractional digits
-        fractional *= 10;                                           //Shift fraction to left
-        LCD_write_data( (uint8_t)((int32_t)fractional%10 + '0') );  //Write the digit(with character 0 as offset)
+#if LCD_FRAME_RATE > 0
+    /* Count the ticks of a frame period and mark the frame as due when it ends */
+    if(++LCD_frame_ticks >= (LCD_TICK_RATE / LCD_FRAME_RATE)){
+        LCD_frame_ticks = 0;
+        LCD_frame_due   = 1;
     }
+#endif
+    
+#if LCD_ANIM_COUNT > 0
+    /* Count the ticks of each playing animation and mark its next frame as due when its period ends */
+    for(uint8_t i=0 ; i < LCD_ANIM_COUNT ; i++){
+        if(LCD_anim_frames[i] && ++LCD_anim_ticks[i] >= LCD_anim_period[i]){
+            LCD_anim_ticks[i] = 0;
+            LCD_anim_due[i]   = 1;
+        }
+    }
+#endif
 }
+
+#endif
+
+#if LCD_FRAME_RATE > 0
+
+/**
+ * Clears the frame(and the whole screen) and resets cursor to 1,1\n
+ * (Has to be called once after "LCD_init" before using the other frame
+ * functions)
+ */
+void LCD_frame_clear(){
+    
+    /* Fill the frame with empty spaces and mark every cell as up to date */
+    for(uint8_t row=0 ; row < LCD_ROWS ; row++){
+        for(uint8_t column=0 ; column < LCD_COLUMNS ; column++){
+            LCD_frame_buffer[row][column] = ' ';
+        }
+        for(uint8_t i=0 ; i < LCD_FRAME_DIRTY_BYTES ; i++){
+            LCD_frame_dirty[row][i] = 0;
+        }
+    }
+    
+    /* Clear the screen to match the frame */
+    LCD_clear();
+}
+
+/**
+ * Writes an ASCII character to the given location of the frame\n
+ * (Nothing is sent to the LCD, the character is shown on the next
+ * "LCD_frame_update" after the frame period, writing the same cell
+ * again before then simply overwrites it)
+ * @param row: Row position(1-4)
+ * @param column: Column position(1-20)
+ * @param character: Character to be written
+ */
+void LCD_frame_write_char(uint8_t row, uint8_t column, char character){
+    
+    row--; column--;  //(Row and column start from 1)
+    
+    /* Only mark the cell if it changes(a clean cell always holds what's on screen) */
+    if(LCD_frame_buffer[row][column] != character){
+        LCD_frame_buffer[row][column] = character;
+        LCD_frame_dirty[row][column >> 3] |= (uint8_t)(1 << (column & 7));
+    }
+}
+
+/**
+ * Writes a string to the given location of the frame\n
+ * (Nothing is sent to the LCD, the string is shown on the next
+ * "LCD_frame_update" after the frame period, writing the same cells
+ * again before then simply overwrites them)\n
+ * (Characters past the end of the row are ignored)\n
+ * <STRONG>!!!The string has to be null terminated otherwise this function will fail or loop forever!!!</STRONG>
+ * @param row: Row position(1-4)
+ * @param column: Column position(1-20)
+ * @param *string: Character array that contains the string
+ */
+void LCD_frame_write_string(uint8_t row, uint8_t column, const char *string){
+    
+    /* Write all characters one by one until you reach "NULL" or the end of the row */
+    while(*string != '\0' && column <= LCD_COLUMNS){
+        LCD_frame_write_char(row, column++, *string++);
+    }
+}
+
+/**
+ * Sends the changed cells of the frame to the LCD if the frame period
+ * has passed(has to be called periodically, e.g. from the main loop)\n
+ * (At most one update per frame period, so the time spent on the LCD
+ * is limited no matter how often the frame is written)\n
+ * (Each run of changed cells costs 1 cursor set, then 1 byte per cell)
+ * @return 1 if the frame was due and sent, 0 otherwise
+ */
+uint8_t LCD_frame_update(){
+    
+    uint8_t mode = LCD_mode;  //Entry mode to be restored
+    
+    /* Do nothing until the frame period passes */
+    if(!LCD_frame_due) return 0;
+    LCD_frame_due = 0;
+    
+    for(uint8_t row=0 ; row < LCD_ROWS ; row++){
+        for(uint8_t column=0 ; column < LCD_COLUMNS ; column++){
+            
+            /* Skip the clean cells */
+            if( !(LCD_frame_dirty[row][column >> 3] & (1 << (column & 7))) ) continue;
+            
+            /* Find the end of the run of changed cells, clearing their marks */
+            uint8_t start = column;
+            while( column < LCD_COLUMNS && (LCD_frame_dirty[row][column >> 3] & (1 << (column & 7))) ){
+                LCD_frame_dirty[row][column >> 3] &= (uint8_t)~(1 << (column & 7));
+                column++;
+            }
+            
+            /* Write the whole run at once(from left to right, see "LCD_entry_forward") */
+            if(mode == LCD_mode) mode = LCD_entry_forward();
+            LCD_cursor_set(row + 1, start + 1);
+            LCD_write_buffer(&LCD_frame_buffer[row][start], column - start);
+        }
+    }
+    LCD_entry_restore(mode);
+    
+    return 1;
+}
+
+#endif
+
+#if LCD_ANIM_COUNT > 0
+
+/**
+ * Plays an animation on a custom character, so every cell showing that
+ * character is animated at once without being written\n
+ * (The frames are changed by "LCD_anim_update" at the rate counted by
+ * "LCD_tick", the first frame is shown right away)\n
+ * (Cursor location is preserved)
+ * @param id: Animation number(0 to LCD_ANIM_COUNT-1, adding an animation
+ * with the same number replaces the old one)
+ * @param location: CGRAM location to play the animation on(0-7)
+ * @param *frames: Binary patterns of all frames one after the other(8
+ * bytes each)\n
+ * (Declare the frames as "const" to keep them in program memory
+ * instead of RAM, they are read while the animation plays so they have
+ * to stay valid until "LCD_anim_stop")
+ * @param count: Number of frames
+ * @param period: How long each frame is shown for[ticks of "LCD_tick"]
+ */
+void LCD_anim_add(uint8_t id, uint8_t location, const char *frames, uint8_t count, uint16_t period){
+    
+    /* Stop the old animation while changing it("LCD_tick" skips it) */
+    LCD_anim_frames[id] = 0;
+    
+    LCD_anim_location[id] = location;
+    LCD_anim_count[id]    = count;
+    LCD_anim_frame[id]    = 0;
+    LCD_anim_period[id]   = period;
+    LCD_anim_ticks[id]    = 0;
+    LCD_anim_due[id]      = 0;
+    
+    /* Show the first frame and start playing */
+    LCD_set_character(frames, location);
+    LCD_anim_frames[id] = frames;
+}
+
+/**
+ * Stops an animation(the frame it's showing stays on the screen)
+ * @param id: Animation number(0 to LCD_ANIM_COUNT-1)
+ */
+void LCD_anim_stop(uint8_t id){
+    
+    LCD_anim_frames[id] = 0;
+}
+
+/**
+ * Shows the next frame of the animations whose time has come, has to be
+ * called periodically by the main code(e.g. from the main loop)\n
+ * (Each frame costs 9 bytes no matter how many cells show it, plus 1
+ * byte to put the cursor back if any frame was shown)\n
+ * (Cursor location is preserved)
+ * @return Number of frames shown
+ */
+uint8_t LCD_anim_update(){
+    
+    uint8_t shown  = 0;            //Number of frames shown
+    uint8_t cursor = LCD_address;  //Cursor location to be restored
+    uint8_t mode   = LCD_mode;     //Entry mode to be restored
+    
+    for(uint8_t i=0 ; i < LCD_ANIM_COUNT ; i++){
+        
+        /* Skip the animations that aren't due(or were stopped) */
+        if(!LCD_anim_due[i]) continue;
+        LCD_anim_due[i] = 0;
+        if(!LCD_anim_frames[i]) continue;
+        
+        /* Move onto the next frame(back to the first one after the last one) */
+        if(++LCD_anim_frame[i] >= LCD_anim_count[i]) LCD_anim_frame[i] = 0;
+        const char *pattern = LCD_anim_frames[i] + ((uint16_t)LCD_anim_frame[i] << 3);
+        
+        /* Send the frame into the CGRAM location(see "LCD_add_character") */
+        if(!shown) mode = LCD_entry_forward();
+        LCD_write_command( LCD_CMD_CGRAM_SET + (uint8_t)(LCD_anim_location[i]<<3) );
+        LCD_write_buffer(pattern, 8);
+        
+#if LCD_USE_RW && LCD_FRAME_RATE > 0
+        /* Remember the pattern so "LCD_verify" can check it */
+        LCD_glyph_remember(pattern, LCD_anim_location[i]);
+#endif
+        
+        shown++;
+    }
+    
+    /* Point the cursor back from "CGRAM" to the saved "DDRAM" address(once for all the frames) */
+    if(shown){
+        LCD_entry_restore(mode);
+        LCD_write_command(LCD_CMD_DDRAM_SET | cursor);
+    }
+    
+    return shown;
+}
+
+#endif
+
+#if LCD_USE_RW && LCD_FRAME_RATE > 0
+
+/**
+ * Reads back a small part of the screen and the custom characters, and
+ * rewrites only the parts that don't match the frame(e.g. after
+ * electrical noise)\n
+ * (Has to be called periodically, e.g. from the main loop, each call
+ * checks "LCD_VERIFY_CHUNK" cells or 1 custom character, so the whole
+ * screen is checked in turns without blocking for long)\n
+ * (Cells waiting for the next "LCD_frame_update" are skipped)\n
+ * (Cursor location is restored after the check)\n
+ * <STRONG>Only works if the screen is written with the frame functions and
+ * the custom characters with "LCD_add_character"!</STRONG>
+ * @return Number of cells or custom characters that were repaired
+ */
+uint8_t LCD_verify(){
+    
+    uint8_t repaired = 0;  //Number of repaired cells/characters
+    
+    /* Remember the tracked address to restore it at the end(reading it back
+     * could catch the LCD still busy with the last command, before it moved) */
+    uint8_t address = LCD_address;
+    
+    /* Read the cells and the character rows from left to right/top to bottom */
+    uint8_t mode = LCD_entry_forward();
+    
+    if(LCD_verify_row < LCD_ROWS){
+        
+        /*---------- Check the next chunk of cells on the current row ----------*/
+        uint8_t row    = LCD_verify_row;
+        uint8_t column = LCD_verify_column;
+        LCD_cursor_set(row + 1, column + 1);
+        
+        for(uint8_t i=0 ; i < LCD_VERIFY_CHUNK && column < LCD_COLUMNS ; i++, column++){
+            
+            char actual = (char)LCD_read_byte(1);  //Read the cell(address moves to the next cell)
+            
+            /* Skip the cells that will be written anyway, repair the rest if they don't match */
+            if( LCD_frame_dirty[row][column >> 3] & (1 << (column & 7)) ) continue;
+            if( actual != LCD_frame_buffer[row][column] ){
+                LCD_cursor_set(row + 1, column + 1);
+                LCD_write_data(LCD_frame_buffer[row][column]);  //(Address moves to the next cell)
+                repaired++;
+            }
+        }
+        
+        /* Move onto the next chunk(next row after the end of the row) */
+        if(column == LCD_COLUMNS){
+            column = 0;
+            LCD_verify_row++;
+        }
+        LCD_verify_column = column;
+    }
+    else{
+        
+        /*---------- Check the next custom character ----------*/
+        uint8_t location = LCD_verify_row - LCD_ROWS;
+        const char *pattern = LCD_glyph_pattern[location];
+        
+        if(LCD_glyph_loaded & (1 << location)){
+            LCD_write_command( LCD_CMD_CGRAM_SET + (uint8_t)(location<<3) );
+            for(uint8_t i=0 ; i < 8 ; i++){
+                if( (LCD_read_byte(1) & 0b00011111) != (pattern[i] & 0b00011111) ){
+                    LCD_write_command( LCD_CMD_CGRAM_SET + (uint8_t)(location<<3) );  //Rewrite the whole character
+                    LCD_write_buffer(pattern, 8);
+                    repaired++;
+                    break;
+                }
+            }
+        }
+        
+        /* Move onto the next character(back to the first row after the last one) */
+        if(++LCD_verify_row == LCD_ROWS + 8) LCD_verify_row = 0;
+    }
+    
+    /* Restore the entry mode and the cursor location */
+    LCD_entry_restore(mode);
+    LCD_write_command(LCD_CMD_DDRAM_SET | address);
+    
+    return repaired;
+}
+
+/**
+ * Checks if the LCD still follows the library(it may lose the 4-bit mode
+ * after a supply dip or a glitch on "EN"), and brings it back if it
+ * doesn't without calling "LCD_init"\n
+ * (Should be called periodically, e.g. before "LCD_verify")\n
+ * (The custom characters added with "LCD_add_character" are sent again
+ * and the whole frame is redrawn by the next "LCD_frame_update")\n
+ * (Cursor location is restored after the check)
+ * @return 1 if the LCD had to be brought back, 0 if it was fine
+ */
+uint8_t LCD_resync(){
+    
+    uint8_t address = LCD_address;  //Cursor location to be restored
+    
+    /*---------- Move the cursor to the probe address and read it back ----------*/
+    LCD_write_command(LCD_CMD_DDRAM_SET | LCD_RESYNC_PROBE);
+    LCD_BUSY_WAIT();
+    if(LCD_read_byte(0) == LCD_RESYNC_PROBE){  //(Not busy and at the probe address)
+        LCD_write_command(LCD_CMD_DDRAM_SET | address);
+        return 0;
+    }
+    
+#if LCD_USE_BATCH
+    LCD_batch_entry = 0;  //(Entry mode of the LCD isn't known anymore)
+#endif
+    
+    /*---------- Get the 4-bit mode and the settings back ----------*/
+    LCD_sync();
+    
+    /*---------- Send the custom characters again ----------*/
+    uint8_t mode = LCD_entry_forward();
+    for(uint8_t location=0 ; location < 8 ; location++){
+        if(LCD_glyph_loaded & (1 << location)){
+            LCD_write_command( LCD_CMD_CGRAM_SET + (uint8_t)(location<<3) );
+            LCD_write_buffer(LCD_glyph_pattern[location], 8);
+        }
+    }
+    LCD_entry_restore(mode);
+    
+    /*---------- Mark the whole frame as changed(redrawn by the next "LCD_frame_update") ----------*/
+    for(uint8_t row=0 ; row < LCD_ROWS ; row++){
+        for(uint8_t i=0 ; i < LCD_FRAME_DIRTY_BYTES ; i++){
+            LCD_frame_dirty[row][i] = 0xFF;
+        }
+    }
+    LCD_frame_due = 1;
+    
+    /* Restore the cursor location */
+    LCD_write_command(LCD_CMD_DDRAM_SET | address);
+    
+    return 1;
+}
+
+#endif
+
+#if LCD_QUEUE_SIZE > 0
+
+/**
+ * Queues an ASCII character to be written at the given location, safe
+ * to call from an interrupt while the main code is using the LCD\n
+ * (Nothing is sent to the LCD, the main code sends the queued characters
+ * with "LCD_drain", interrupts are never disabled)\n
+ * (With LCD_QUEUE_URGENT they are also sent between the characters of
+ * any write the main code is doing, so they don't wait for it to end)\n
+ * <STRONG>Only one interrupt(or one context) may post, and only the main
+ * code may drain!</STRONG>
+ * @param row: Row position(1-4)
+ * @param column: Column position(1-20)
+ * @param character: Character to be written
+ * @return 1 if the character was queued, 0 if the queue was full
+ */
+uint8_t LCD_post_char(uint8_t row, uint8_t column, char character){
+    
+    uint8_t head = LCD_queue_head;  //Only this function changes the head
+    
+    /* If the queue is full, give up */
+    if( (uint8_t)(head - LCD_queue_tail) >= LCD_QUEUE_SIZE ) return 0;
+    
+    /* Offset the column address with the corresponding row */
+    if(row == 1) column += LCD_CMD_DDRAM_LINE_1;
+    if(row == 2) column += LCD_CMD_DDRAM_LINE_2;
+    if(row == 3) column += LCD_CMD_DDRAM_LINE_3;
+    if(row == 4) column += LCD_CMD_DDRAM_LINE_4;
+    
+    /* Fill the entry first, then publish it by moving the head(single byte write) */
+    LCD_queue_address[head & (LCD_QUEUE_SIZE-1)]   = column;
+    LCD_queue_character[head & (LCD_QUEUE_SIZE-1)] = character;
+    LCD_queue_head = head + 1;
+    
+    return 1;
+}
+
+/**
+ * Queues a string to be written at the given location, safe to call
+ * from an interrupt while the main code is using the LCD\n
+ * (See "LCD_post_char")\n
+ * <STRONG>!!!The string has to be null terminated otherwise this function will fail or loop forever!!!</STRONG>
+ * @param row: Row position(1-4)
+ * @param column: Column position(1-20)
+ * @param *string: Character array that contains the string
+ * @return Number of characters queued(less than the string length if
+ * the queue got full)
+ */
+uint8_t LCD_post_string(uint8_t row, uint8_t column, const char *string){
+    
+    uint8_t count = 0;  //Number of characters queued
+    
+    /* Queue all characters one by one until you reach "NULL" or the queue is full */
+    while(string[count] != '\0'){
+        if( !LCD_post_char(row, column + count, string[count]) ) break;
+        count++;
+    }
+    
+    return count;
+}
+
+/**
+ * Writes the characters queued with "LCD_post_char"/"LCD_post_string"
+ * (has to be called periodically by the main code, e.g. from the main loop)\n
+ * (The cursor location is only set when the next character isn't right
+ * after the previous one)\n
+ * (Only the characters queued before the call are written, so an
+ * interrupt that keeps posting can't keep it busy forever)\n
+ * (The characters go from left to right whatever the entry mode is, the
+ * entry mode and the cursor location are restored afterwards)
+ * @return Number of characters written
+ */
+uint8_t LCD_drain(){
+    
+    uint8_t count = 0;             //Number of characters written
+    uint8_t address = 0;           //DDRAM address of the next character(0 is never a set address command)
+    uint8_t cursor = LCD_address;  //Cursor location to be restored
+    uint8_t head = LCD_queue_head; //Last entry to be written(the ones posted after this wait for the next call)
+    
+    /* Nothing to write(or to restore) */
+    if(LCD_queue_tail == head) return 0;
+    
+    /* Increment without display shift, "address" below counts upwards */
+    uint8_t mode = LCD_entry_forward();
+    
+    /* Write the entries until the tail reaches the head(only this function changes the tail) */
+    while(LCD_queue_tail != head){
+        
+        uint8_t tail = LCD_queue_tail & (LCD_QUEUE_SIZE-1);
+        
+        /* Set the cursor location only if it's not where the previous character left it */
+        if(LCD_queue_address[tail] != address){
+            address = LCD_queue_address[tail];
+            LCD_write_command(address);
+        }
+        LCD_RS_LAT = 1;                                //(Not "LCD_write_data", it would call "LCD_preempt")
+#if LCD_USE_BATCH
+        if( !LCD_batch_open || !LCD_batch_data(LCD_queue_character[tail]) )
+#endif
+        LCD_write_byte(LCD_queue_character[tail]);
+        LCD_address_step(LCD_mode & 0b00010000);
+        address++;
+        count++;
+        
+        /* Free the entry after it's used(single byte write) */
+        LCD_queue_tail++;
+    }
+    
+    /* Restore the entry mode and the cursor location */
+    LCD_entry_restore(mode);
+    LCD_write_command(LCD_CMD_DDRAM_SET | cursor);
+    
+    return count;
+}
+
+#endif
+
+#if LCD_USE_BATCH
+
+/**
+ * Starts a batch, the commands sent until "LCD_batch_end" are held back
+ * and sent as a shorter sequence that leaves the LCD in the same state\n
+ * (Cursor moves are merged into one, display shifts that cancel each
+ * other and repeated entry modes are left out, so are the empty spaces
+ * written on the cells a clear in the batch already emptied)\n
+ * (Characters still show up as they are written, only the commands
+ * are delayed)
+ */
+void LCD_batch_begin(){
+    
+    /* Nothing is held yet, the LCD is where the library left it */
+    LCD_batch_moved      = 0;
+    LCD_batch_lost       = 0;
+    LCD_batch_shift      = 0;
+    LCD_batch_entry      = LCD_ENTRY_MODE;
+    LCD_batch_entry_held = 0;
+    LCD_batch_saved      = 0;
+    for(uint8_t i=0 ; i < 16 ; i++) LCD_batch_blank[i] = 0;  //(Nothing is known to be empty before a clear)
+    
+    LCD_batch_open = 1;
+}
+
+/**
+ * Ends the batch started with "LCD_batch_begin" and sends the commands
+ * still held back\n
+ * (Cursor will be where it would've been without the batch)
+ * @return Number of bytes the batch left out
+ */
+uint16_t LCD_batch_end(){
+    
+    LCD_batch_flush();
+    LCD_batch_open = 0;
+    
+    return LCD_batch_saved;
+}
+
+#endif
+
+#if LCD_TRACE_SIZE > 0
+
+/**
+ * Sends the recorded bus events out one byte at a time(e.g. to a UART)
+ * and empties the trace\n
+ * (Can be turned into the screen, a VCD file and the bus usage on a PC
+ * with "LCD Tools/lcd_replay.c")\n
+ * (Timestamps are read from "LCD_TIMER", it needs to be running even
+ * if "LCD_USE_TIMER" is 0)\n
+ * <u>Format(little-endian):</u>\n
+ * "LCDT", version(1), timer ticks per uS(1), events lost(2, 65535 if more), event count(2),\n
+ * then for each event(oldest first): timer value(2), pins(1)
+ * @param put: Function that sends out a byte
+ */
+void LCD_trace_dump(void (*put)(char)){
+    
+    uint16_t count = LCD_trace_count;
+    uint16_t lost  = LCD_trace_lost;
+    
+    /*---------- Send the header ----------*/
+    put('L'); put('C'); put('D'); put('T');
+    put(1);
+    put(LCD_TIMER_TICKS_PER_US);
+    put((char)lost);  put((char)(lost >> 8));
+    put((char)count); put((char)(count >> 8));
+    
+    /*---------- Send the events from the oldest ----------*/
+    for(uint16_t i = LCD_trace_next - count ; count ; count--, i++){
+        uint16_t index = i & (LCD_TRACE_SIZE - 1);
+        put((char)LCD_trace_time[index]);
+        put((char)(LCD_trace_time[index] >> 8));
+        put((char)LCD_trace_event[index]);
+    }
+    
+    LCD_trace_count = 0;
+    LCD_trace_lost  = 0;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,244 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+/*
+ * Checks that a batch("LCD_batch_begin"/"LCD_batch_end") leaves the LCD in
+ * exactly the same state as the same calls without it, and reports the
+ * bus bytes the batch saves:
+ * - Each sequence of random calls runs twice on the simulated HD44780,
+ *   once as it is and once inside one batch
+ * - DDRAM, CGRAM, cursor, display shift, entry mode and display control
+ *   have to match, no access is allowed while the LCD is busy
+ * - The count returned by "LCD_batch_end" has to be the bytes really saved
+ * - "-w" runs a screen redraw(clear, then the labels and values written
+ *   again with padding) instead, the typical case for a batch
+ *
+ * Build: cc -std=c99 -O2 -I . -I "../LCD Single File/LCD/Header Files"
+ *           -I "../LCD Single File/LCD/Source Files" -o batch_check batch_check.c
+ * Usage: batch_check [-n sequences] [-s first seed] [-w] [-v]
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "LCD.h"
+
+#undef  LCD_USE_BATCH
+#define LCD_USE_BATCH  1
+#undef  LCD_QUEUE_SIZE
+#define LCD_QUEUE_SIZE 0
+
+#include "LCD.c"
+
+
+#define MAX_CALLS 64
+
+enum{ CALL_CURSOR_SET, CALL_CURSOR_INCREMENT, CALL_CURSOR_DECREMENT, CALL_WRITE_STRING, CALL_WRITE_VARIABLE,
+      CALL_CLEAR, CALL_SHIFT_RESET, CALL_SHIFT_LEFT, CALL_SHIFT_RIGHT, CALL_ENTRY_ID, CALL_ENTRY_SHIFT,
+      CALL_CURSOR_DISPLAY, CALL_SET_CHARACTER, CALL_COUNT };
+
+typedef struct{
+    int     call;
+    int32_t a, b;
+    char    text[21];
+} Call;
+
+static uint64_t random_state;
+static int      verbose;
+
+
+static uint32_t next_random(void){
+    random_state = random_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (uint32_t)(random_state >> 33);
+}
+
+static int random_below(int n){
+    return (int)(next_random() % (uint32_t)n);
+}
+
+/* Random calls(texts are mostly spaces and short words, like padded labels) */
+static int random_calls(Call *calls){
+    
+    static const char *words[] = { " ", "  ", "    ", "Temp", "ON ", "OFF", ":", "12.5", "  --  ", "\x01" };
+    int count = random_below(MAX_CALLS) + 1;
+    
+    for(int i=0 ; i < count ; i++){
+        Call *c = &calls[i];
+        memset(c, 0, sizeof(*c));
+        c->call = random_below(CALL_COUNT);
+        c->a = random_below(LCD_ROWS) + 1;
+        c->b = random_below(LCD_COLUMNS) + 1;
+        if(c->call == CALL_WRITE_VARIABLE){
+            c->a = (int32_t)next_random() >> random_below(32);
+            c->b = random_below(8);
+        }
+        if(c->call == CALL_ENTRY_ID || c->call == CALL_ENTRY_SHIFT || c->call == CALL_CURSOR_DISPLAY) c->a = random_below(2);
+        if(c->call == CALL_SET_CHARACTER){
+            c->a = random_below(8);
+            for(int j=0 ; j < 8 ; j++) c->text[j] = (char)random_below(32);
+        }
+        while(c->call == CALL_WRITE_STRING && strlen(c->text) < 12) strcat(c->text, words[random_below(10)]);
+    }
+    return count;
+}
+
+/* A screen redraw: clear, then every label and value written again with padding */
+static int redraw_calls(Call *calls){
+    
+    static const char *labels[4] = { "Temp:       C     ", "Hum:        %     ", "Fan:  OFF         ", "                  " };
+    int count = 0;
+    
+    calls[count++] = (Call){ CALL_CLEAR, 0, 0, "" };
+    for(int r=0 ; r < LCD_ROWS ; r++){
+        calls[count++] = (Call){ CALL_CURSOR_SET, r + 1, 1, "" };
+        calls[count] = (Call){ CALL_WRITE_STRING, 0, 0, "" };
+        strncpy(calls[count++].text, labels[r], LCD_COLUMNS);
+        if(r < 2){
+            calls[count++] = (Call){ CALL_CURSOR_SET, r + 1, 7, "" };
+            calls[count++] = (Call){ CALL_WRITE_VARIABLE, random_below(1000), 4, "" };
+        }
+    }
+    return count;
+}
+
+static void library_call(const Call *c){
+    switch(c->call){
+        case CALL_CURSOR_SET:       LCD_cursor_set((uint8_t)c->a, (uint8_t)c->b); break;
+        case CALL_CURSOR_INCREMENT: LCD_cursor_increment(); break;
+        case CALL_CURSOR_DECREMENT: LCD_cursor_decrement(); break;
+        case CALL_WRITE_STRING:     LCD_write_string(c->text); break;
+        case CALL_WRITE_VARIABLE:   LCD_write_variable(c->a, (uint8_t)c->b); break;
+        case CALL_CLEAR:            LCD_clear(); break;
+        case CALL_SHIFT_RESET:      LCD_shift_reset(); break;
+        case CALL_SHIFT_LEFT:       LCD_shift_left(); break;
+        case CALL_SHIFT_RIGHT:      LCD_shift_right(); break;
+        case CALL_ENTRY_ID:         LCD_configure_entry_id((uint8_t)c->a); break;
+        case CALL_ENTRY_SHIFT:      LCD_configure_entry_shift((uint8_t)c->a); break;
+        case CALL_CURSOR_DISPLAY:   LCD_configure_cursor_display((uint8_t)c->a); break;
+        case CALL_SET_CHARACTER:    LCD_set_character(c->text, (uint8_t)c->a); break;
+    }
+}
+
+static void print_call(const Call *c){
+    static const char *names[] = { "LCD_cursor_set", "LCD_cursor_increment", "LCD_cursor_decrement", "LCD_write_string",
+                                   "LCD_write_variable", "LCD_clear", "LCD_shift_reset", "LCD_shift_left", "LCD_shift_right",
+                                   "LCD_configure_entry_id", "LCD_configure_entry_shift", "LCD_configure_cursor_display",
+                                   "LCD_set_character" };
+    printf("    %s(", names[c->call]);
+    switch(c->call){
+        case CALL_CURSOR_SET:
+        case CALL_WRITE_VARIABLE:   printf("%ld, %ld", (long)c->a, (long)c->b); break;
+        case CALL_WRITE_STRING:     printf("\"%s\"", c->text); break;
+        case CALL_ENTRY_ID: case CALL_ENTRY_SHIFT:
+        case CALL_CURSOR_DISPLAY:   printf("%ld", (long)c->a); break;
+        case CALL_SET_CHARACTER:
+            printf("\"");
+            for(int j=0 ; j < 8 ; j++) printf("\\x%02X", (uint8_t)c->text[j]);
+            printf("\", %ld", (long)c->a);
+            break;
+    }
+    printf(");\n");
+}
+
+/* Runs the calls from a fresh start(inside one batch or not), returns the bus bytes sent */
+static long run(const Call *calls, int count, int batch, Hd44780 *state, uint16_t *saved){
+    
+    host_reset();
+    LCD_mode       = LCD_MODE_DEFAULT;
+    LCD_batch_open = 0;
+    LCD_init();
+    long before = host_lcd.commands + host_lcd.datas;
+    
+    if(batch) LCD_batch_begin();
+    for(int i=0 ; i < count ; i++) library_call(&calls[i]);
+    if(batch) *saved = LCD_batch_end();
+    
+    *state = host_lcd;
+    return host_lcd.commands + host_lcd.datas - before;
+}
+
+/* What differs between the two LCDs(NULL if nothing) */
+static const char* compare(const Hd44780 *a, const Hd44780 *b){
+    if(memcmp(a->ddram, b->ddram, sizeof(a->ddram)))  return "DDRAM";
+    if(memcmp(a->cgram, b->cgram, sizeof(a->cgram)))  return "CGRAM";
+    if(a->ac != b->ac || a->cg != b->cg)              return "cursor";
+    if(a->shift != b->shift)                          return "display shift";
+    if(a->id != b->id || a->sh != b->sh)              return "entry mode";
+    if(a->display != b->display)                      return "display control";
+    if(a->early || b->early)                          return "access while the LCD was busy";
+    return NULL;
+}
+
+
+int main(int argc, char **argv){
+    
+    long     sequences = 100000;
+    uint64_t first     = 1;
+    int      redraw    = 0;
+    
+    for(int i=1 ; i < argc ; i++){
+        if     (!strcmp(argv[i], "-n") && i+1 < argc) sequences = atol(argv[++i]);
+        else if(!strcmp(argv[i], "-s") && i+1 < argc) first     = strtoull(argv[++i], NULL, 10);
+        else if(!strcmp(argv[i], "-w"))               redraw    = 1;
+        else if(!strcmp(argv[i], "-v"))               verbose   = 1;
+        else{
+            fprintf(stderr, "usage: %s [-n sequences] [-s first seed] [-w] [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+    
+    static Call calls[MAX_CALLS];
+    long plain_total = 0, batch_total = 0;
+    for(long n=0 ; n < sequences ; n++){
+        
+        random_state = (first + (uint64_t)n) * 0x9E3779B97F4A7C15ULL + 1;
+        int count = redraw ? redraw_calls(calls) : random_calls(calls);
+        if(verbose) for(int i=0 ; i < count ; i++) print_call(&calls[i]);
+        
+        Hd44780  plain_state, batch_state;
+        uint16_t saved = 0;
+        long plain = run(calls, count, 0, &plain_state, &saved);
+        long batch = run(calls, count, 1, &batch_state, &saved);
+        
+        const char *wrong = compare(&plain_state, &batch_state);
+        if(!wrong && saved != plain - batch) wrong = "saved count";
+        if(wrong){
+            printf("seed %llu fails(%s differs), run it with -s %llu -n 1 -v to see the calls\n",
+                   (unsigned long long)(first + (uint64_t)n), wrong, (unsigned long long)(first + (uint64_t)n));
+            return 1;
+        }
+        plain_total += plain;
+        batch_total += batch;
+    }
+    
+    printf("%ld %s matched, bus bytes: %ld without batch, %ld with batch(%.1f%% saved)\n",
+           sequences, redraw ? "redraws" : "sequences", plain_total, batch_total,
+           plain_total ? 100.0 * (plain_total - batch_total) / plain_total : 0.0);
+    return 0;
+}
\ No newline at end of file
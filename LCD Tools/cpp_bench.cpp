@@ -0,0 +1,175 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+/*
+ * Draws the same screen(clear, a custom character, two texts and a live
+ * value) on the simulated LCD in 3 ways and compares them:
+ * - "Lcd<>":    a program built by the compiler from "LCD.hpp" pieces
+ * - "LCD_exec": the same program written by hand as a byte array in C
+ * - "LCD_...":  the usual C calls("LCD_cursor_set", "LCD_write_string", ...)
+ * For each way it prints the bytes of program data, the bytes sent to the
+ * LCD, the bus time on the LCD and the CPU time of the PC per screen. The
+ * screens are checked to be the same.
+ *
+ * The code size of each way is the size of its "draw_..." function:
+ *   nm --print-size cpp_bench > cpp_bench.nm && lcd_size -a cpp_bench.nm | grep draw_
+ *
+ * Build: c++ -std=c++17 -O2 -I . -I "../LCD Single File/LCD/Header Files"
+ *           -I "../LCD Single File/LCD/Source Files" -o cpp_bench cpp_bench.cpp
+ * Usage: cpp_bench [-n screens]
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "LCD.hpp"
+
+#undef  LCD_USE_EXEC
+#define LCD_USE_EXEC 1
+
+#include "LCD.c"
+
+
+#define ROUNDS 5  //Rounds of the CPU time measurement
+
+using Display = LCD::Lcd<4, 20>;
+
+static const char bell[8] = { 0b00100, 0b01110, 0b01110, 0b01110, 0b11111, 0b00000, 0b00100, 0b00000 };
+
+static constexpr auto screen = Display::screen(Display::clear(),
+                                               Display::glyph<1>(bell),
+                                               Display::text<1, 1>("Temp:"),
+                                               Display::value<1, 7>(0, 6, 0),
+                                               Display::text<4, 18>("end"));
+
+static const uint8_t hand[] = { LCD_OP_CLEAR,
+                                LCD_OP_GLYPH, 1, 0b00100, 0b01110, 0b01110, 0b01110, 0b11111, 0b00000, 0b00100, 0b00000,
+                                LCD_OP_ADDRESS, LCD_AT(1,1),  LCD_OP_WRITE, 5, 'T', 'e', 'm', 'p', ':',
+                                LCD_OP_ADDRESS, LCD_AT(1,7),  LCD_OP_VALUE, 0, 6, 0,
+                                LCD_OP_ADDRESS, LCD_AT(4,18), LCD_OP_WRITE, 3, 'e', 'n', 'd',
+                                LCD_OP_END };
+
+static_assert(sizeof(screen.code) == sizeof(hand), "The compiler built a different program");
+
+
+/* The 3 ways of drawing the screen(not inlined, so their code can be measured) */
+__attribute__((noinline)) static void draw_cpp(const int32_t *values){
+    Display::exec(screen, values);
+}
+
+__attribute__((noinline)) static void draw_exec(const int32_t *values){
+    LCD_exec(hand, values);
+}
+
+__attribute__((noinline)) static void draw_calls(const int32_t *values){
+    LCD_clear();
+    LCD_set_character(bell, 1);
+    LCD_cursor_set(1, 1);
+    LCD_write_string("Temp:");
+    LCD_cursor_set(1, 7);
+    LCD_write_variable(values[0], 6);
+    LCD_cursor_set(4, 18);
+    LCD_write_string("end");
+}
+
+
+typedef struct{
+    const char *name;
+    void      (*draw)(const int32_t*);
+    size_t      data;       //Bytes of program data(not counting the code)
+    long        bytes;      //Bytes sent to the LCD per screen
+    double      bus_us;     //Simulated time per screen[uS]
+    double      cpu_ns;     //Time of the PC per screen[nS]
+    uint8_t     ddram[0x80];
+    uint8_t     cgram[64];
+} Way;
+
+
+int main(int argc, char **argv){
+    
+    long screens = 20000;
+    
+    for(int i=1 ; i < argc ; i++){
+        if(!strcmp(argv[i], "-n") && i+1 < argc) screens = atol(argv[++i]);
+        else{
+            fprintf(stderr, "usage: %s [-n screens]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(screens < 1) screens = 1;
+    
+    Way way[3] = {
+        { "Lcd<>",    draw_cpp,   sizeof(screen.code), 0, 0, 0, {0}, {0} },
+        { "LCD_exec", draw_exec,  sizeof(hand),        0, 0, 0, {0}, {0} },
+        { "LCD_...",  draw_calls, sizeof(bell) + sizeof("Temp:") + sizeof("end"), 0, 0, 0, {0}, {0} }
+    };
+    
+    for(int w=0 ; w < 3 ; w++){
+        
+        /*---------- Draw once to count the bytes and the bus time ----------*/
+        host_reset();
+        LCD_init();
+        int32_t values[1] = { 235 };
+        long     sent = host_lcd.commands + host_lcd.datas;
+        uint64_t from = host_now;
+        way[w].draw(values);
+        way[w].bytes  = host_lcd.commands + host_lcd.datas - sent;
+        way[w].bus_us = (host_now - from) / 1000.0;
+        memcpy(way[w].ddram, host_lcd.ddram, sizeof(way[w].ddram));
+        memcpy(way[w].cgram, host_lcd.cgram, sizeof(way[w].cgram));
+    }
+    
+    /*---------- Draw many times to measure the CPU time(best of a few rounds, ways taking turns) ----------*/
+    for(int round=0 ; round < ROUNDS ; round++){
+        for(int w=0 ; w < 3 ; w++){
+            int32_t values[1];
+            struct timespec start, end;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for(long i=0 ; i < screens ; i++){
+                values[0] = (int32_t)(i % 1000);
+                way[w].draw(values);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            double cpu_ns = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / screens;
+            if(!round || cpu_ns < way[w].cpu_ns) way[w].cpu_ns = cpu_ns;
+        }
+    }
+    
+    /*---------- Print the results ----------*/
+    int same = 1;
+    for(int w=1 ; w < 3 ; w++){
+        same &= !memcmp(way[w].ddram, way[0].ddram, sizeof(way[0].ddram)) && !memcmp(way[w].cgram, way[0].cgram, sizeof(way[0].cgram));
+    }
+    printf("%-10s %10s %10s %12s %12s\n", "way", "data[B]", "sent[B]", "bus[uS]", "cpu[nS]");
+    for(int w=0 ; w < 3 ; w++){
+        printf("%-10s %10zu %10ld %12.1f %12.1f\n", way[w].name, way[w].data, way[w].bytes, way[w].bus_us, way[w].cpu_ns);
+    }
+    printf("screens are %s\n", same ? "the same" : "DIFFERENT");
+    return same ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+/* Generated by lcd_strings from "texts.txt", don't edit */
+
+#include "LCD.h"
+
+const char * const LCD_tokens[] = {
+    "Temperatur",
+    "Temp\351rature",
+    "Pump",
+    "Einstellungen",
+    "aram\350tres",
+    "e ",
+    "Erreur ",
+    "ettings",
+    "Sensor",
+    "fehler",
+    " error"
+};
+
+static const char * const LCD_texts_en[] = {
+    "\200e:",  /* temp */
+    "\200\205high",  /* temp_high */
+    "\200\205low",  /* temp_low */
+    "\202 running",  /* pump_on */
+    "\202 stopped",  /* pump_off */
+    "\202\212",  /* pump_err */
+    "\210\212",  /* sensor_err */
+    "S\207",  /* settings */
+    "Sav\205s\207",  /* save */
+    "\001 Back"   /* back */
+};
+
+static const char * const LCD_texts_de[] = {
+    "\200:",  /* temp */
+    "\200 hoch",  /* temp_high */
+    "\200 niedrig",  /* temp_low */
+    "\202\205l\037\344uft",  /* pump_on */
+    "\202\205gestoppt",  /* pump_off */
+    "\202en\211",  /* pump_err */
+    "\210\211",  /* sensor_err */
+    "\203",  /* settings */
+    "\203 sichern",  /* save */
+    "\001 Zur\037\374ck"   /* back */
+};
+
+static const char * const LCD_texts_fr[] = {
+    "\201:",  /* temp */
+    "\201 haute",  /* temp_high */
+    "\201 basse",  /* temp_low */
+    "Pomp\205en marche",  /* pump_on */
+    "Pomp\205arr\037\352t\037\351e",  /* pump_off */
+    "\206pompe",  /* pump_err */
+    "\206capteur",  /* sensor_err */
+    "P\204",  /* settings */
+    "Enregistrer p\204",  /* save */
+    "\001 Retour"   /* back */
+};
+
+const char * const * const LCD_texts[] = {
+    LCD_texts_en,
+    LCD_texts_de,
+    LCD_texts_fr
+};
@@ -0,0 +1,21 @@
+/* Generated by lcd_strings from "texts.txt", don't edit */
+
+#define LCD_LANGUAGE_EN 0
+#define LCD_LANGUAGE_DE 1
+#define LCD_LANGUAGE_FR 2
+#define LCD_LANGUAGE_COUNT 3
+
+#define LCD_TEXT_TEMP 0
+#define LCD_TEXT_TEMP_HIGH 1
+#define LCD_TEXT_TEMP_LOW 2
+#define LCD_TEXT_PUMP_ON 3
+#define LCD_TEXT_PUMP_OFF 4
+#define LCD_TEXT_PUMP_ERR 5
+#define LCD_TEXT_SENSOR_ERR 6
+#define LCD_TEXT_SETTINGS 7
+#define LCD_TEXT_SAVE 8
+#define LCD_TEXT_BACK 9
+#define LCD_TEXT_COUNT 10
+
+extern const char * const LCD_tokens[];
+extern const char * const * const LCD_texts[];
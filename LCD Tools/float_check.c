@@ -0,0 +1,166 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+/*
+ * Checks "LCD_write_float" against printf("%.*f") on the simulated LCD:
+ * - Edge cases: zeros(also -0.0), ties at every position(0.5, 0.125...),
+ *   carries into the integer part(9.9999995), the smallest and the
+ *   largest floats that fit, and the ones that don't(written as '*')
+ * - Random floats(all exponents below 2^32) with every f_digit(0-9)
+ * - Exhaustive: every float with the given f_digit(-e), or the bit
+ *   patterns between -a and -b(hex), positive and negative
+ * The first mismatches are printed, the exit code is 1 if there were any.
+ *
+ * Build: cc -std=c99 -O2 -I . -I "../LCD Single File/LCD/Header Files"
+ *           -I "../LCD Single File/LCD/Source Files" -o float_check float_check.c
+ * Usage: float_check [-n random floats] [-e f_digit [-a first] [-b last]]
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "LCD.h"
+
+#undef  LCD_USE_FLOAT
+#define LCD_USE_FLOAT 1
+#undef  LCD_ROWS
+#define LCD_ROWS      2
+#undef  LCD_COLUMNS
+#define LCD_COLUMNS   40
+
+#include "LCD.c"
+
+
+#define LARGEST 0x4F7FFFFFu  //Bit pattern of the largest float below 2^32(4294967040)
+
+static long checked, wrong;
+
+
+/* Float with the given bit pattern */
+static float from_bits(uint32_t bits){
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+/* Writes the float on line 1 and compares it with printf(or '*') */
+static void check(float value, uint8_t left_offset, uint8_t f_digit){
+    
+    char expected[64], actual[41];
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    
+    if((bits & 0x7FFFFFFFu) > LARGEST) strcpy(expected, "*");  //(Also NaN and infinity)
+    else                               snprintf(expected, sizeof(expected), "%.*f", (f_digit > 9) ? 9 : f_digit, (double)value);
+    int length = (int)strlen(expected);
+    if(left_offset > length){
+        memmove(expected + (left_offset - length), expected, (size_t)length + 1);
+        memset(expected, ' ', (size_t)(left_offset - length));
+        length = left_offset;
+    }
+    
+    memset(host_lcd.ddram, ' ', 40);
+    LCD_cursor_set(1, 1);
+    LCD_write_float(value, left_offset, f_digit);
+    memcpy(actual, host_lcd.ddram, (size_t)length);
+    actual[length] = '\0';
+    
+    checked++;
+    if(strcmp(actual, expected) || host_lcd.ac != length){
+        if(++wrong <= 20){
+            printf("%.9g(0x%08lX) offset %d f_digit %d: \"%s\", printf: \"%s\"\n",
+                   (double)value, (unsigned long)bits, left_offset, f_digit, actual, expected);
+        }
+    }
+}
+
+
+int main(int argc, char **argv){
+    
+    long     randoms = 1000000;
+    int      f_exhaustive = -1;
+    uint32_t first = 0, last = LARGEST;
+    
+    for(int i=1 ; i < argc ; i++){
+        if     (!strcmp(argv[i], "-n") && i+1 < argc) randoms      = atol(argv[++i]);
+        else if(!strcmp(argv[i], "-e") && i+1 < argc) f_exhaustive = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-a") && i+1 < argc) first        = (uint32_t)strtoul(argv[++i], NULL, 16);
+        else if(!strcmp(argv[i], "-b") && i+1 < argc) last         = (uint32_t)strtoul(argv[++i], NULL, 16);
+        else{
+            fprintf(stderr, "usage: %s [-n random floats] [-e f_digit [-a first] [-b last]]\n", argv[0]);
+            return 2;
+        }
+    }
+    
+    host_reset();
+    LCD_init();
+    
+    if(f_exhaustive >= 0){
+        
+        /*---------- Every bit pattern in the range, both signs ----------*/
+        for(uint32_t bits = first ; ; bits++){
+            check(from_bits(bits), 0, (uint8_t)f_exhaustive);
+            check(from_bits(bits | 0x80000000u), 0, (uint8_t)f_exhaustive);
+            if(bits == last) break;
+        }
+    }
+    else{
+        
+        /*---------- Edge cases with every f_digit ----------*/
+        static const float edges[] = {
+            0.0f, 0.5f, 1.5f, 2.5f, 0.25f, 0.75f, 0.125f, 0.375f, 0.0625f, 0.3125f, 0.05f, 0.15f, 0.45f,
+            0.04f, 0.005f, 0.0005f, 1e-9f, 5e-10f, 1e-10f, 9.5f, 9.9999995f, 99.995f, 0.999999999f,
+            123.456f, 1234567.875f, 16777216.0f, 16777217.0f, 4294967040.0f, 4294967296.0f, 1e10f, 3.4e38f,
+            1.17549435e-38f, 1.4e-45f
+        };
+        for(int sign=0 ; sign < 2 ; sign++){
+            for(size_t i=0 ; i < sizeof(edges)/sizeof(edges[0]) ; i++){
+                for(uint8_t f=0 ; f <= 10 ; f++) check(sign ? -edges[i] : edges[i], 0, f);
+            }
+        }
+        check(from_bits(0x7F800000u), 0, 2);  //Infinity
+        check(from_bits(0xFF800000u), 0, 2);
+        check(from_bits(0x7FC00000u), 0, 2);  //NaN
+        check(-0.0f, 12, 3);                  //With an offset
+        check(-1.25f, 12, 1);
+        check(1234.5f, 2, 2);                 //(Offset smaller than the text)
+        
+        /*---------- Random floats below 2^32 ----------*/
+        uint64_t state = 1;
+        for(long n=0 ; n < randoms ; n++){
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            uint32_t bits = (uint32_t)(state >> 32);
+            if((bits & 0x7FFFFFFFu) > LARGEST) bits = (bits & 0x80000000u) | (bits % LARGEST);
+            check(from_bits(bits), 0, (uint8_t)((state >> 20) % 10));
+        }
+    }
+    
+    printf("%ld floats checked, %ld wrong\n", checked, wrong);
+    return wrong ? 1 : 0;
+}
\ No newline at end of file
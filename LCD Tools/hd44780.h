@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Simulated HD44780(4-bit interface), shared by the programs in "LCD Tools".
+ * Every byte sent to(or read from) the controller is given to
+ * "hd44780_execute" with the time it was sent at(or every "EN" pulse to
+ * "hd44780_nibble"), the controller keeps the DDRAM/CGRAM contents, the
+ * address counter, the display shift and counts the accesses made while it
+ * was still busy.
+ */
+
+
+#ifndef HD44780_H
+#define	HD44780_H
+
+#include <stdint.h>
+#include <string.h>
+
+
+#define EXEC_SHORT_NS 37000UL    //Execution time of most instructions(datasheet)[nS]
+#define EXEC_LONG_NS  1520000UL  //Execution time of "Clear Display" and "Return Home"[nS]
+
+
+/* Simulated HD44780 */
+typedef struct{
+    uint8_t  ddram[128];
+    uint8_t  cgram[64];
+    uint8_t  ac;           //Address counter
+    uint8_t  cg;           //1 if the address counter points to CGRAM
+    uint8_t  id;           //Entry mode increment(1) or decrement(0)
+    uint8_t  sh;           //Entry mode display shift
+    uint8_t  display;      //Display, cursor and blink bits
+    uint8_t  four_bit;     //1 after "Function Set" with 4-bit interface
+    uint8_t  half;         //1 if the higher nibble of a byte has been received
+    uint8_t  high;         //Received higher nibble
+    uint8_t  out;          //Byte being read out(4-bit reads)
+    int      shift;        //Display shift(characters to the left)
+    uint64_t busy_until;   //Time the last instruction finishes[nS]
+    uint64_t busy_total;   //Total execution time of all instructions[nS]
+    long     commands, datas, reads, early;
+} Hd44780;
+
+
+/* Puts the controller into its power-up state(8-bit interface, empty DDRAM) */
+static inline void hd44780_reset(Hd44780 *lcd){
+    memset(lcd, 0, sizeof(*lcd));
+    memset(lcd->ddram, ' ', sizeof(lcd->ddram));
+    lcd->id = 1;
+}
+
+/* Moves the address counter like the controller does(line 1 and line 2 continue into each other) */
+static inline void hd44780_step(Hd44780 *lcd, int increment){
+    
+    if(lcd->cg){
+        lcd->ac = (uint8_t)((lcd->ac + (increment ? 1 : -1)) & 0x3F);
+    }
+    else if(increment){
+        lcd->ac = (lcd->ac == 0x27) ? 0x40 : (lcd->ac == 0x67) ? 0x00 : (uint8_t)(lcd->ac + 1);
+    }
+    else{
+        lcd->ac = (lcd->ac == 0x40) ? 0x27 : (lcd->ac == 0x00) ? 0x67 : (uint8_t)(lcd->ac - 1);
+    }
+}
+
+/* Runs a complete byte written to(or read from) the controller */
+static inline void hd44780_execute(Hd44780 *lcd, uint64_t now, int rs, int rw, uint8_t value){
+    
+    uint64_t time = EXEC_SHORT_NS;
+    
+    /* Accesses before the last instruction finished are lost on a real LCD(reading the busy flag is allowed) */
+    if((rs || !rw) && now < lcd->busy_until) lcd->early++;
+    
+    if(rw){
+        if(!rs) return;                  //Busy flag and address, nothing to execute
+        hd44780_step(lcd, lcd->id);              //Reading data moves the address like writing
+        lcd->reads++;
+    }
+    else if(rs){
+        if(lcd->cg) lcd->cgram[lcd->ac & 0x3F] = value;
+        else        lcd->ddram[lcd->ac & 0x7F] = value;
+        hd44780_step(lcd, lcd->id);
+        if(lcd->sh && !lcd->cg) lcd->shift += lcd->id ? 1 : -1;  //(Writing into CGRAM doesn't shift the display)
+        lcd->datas++;
+    }
+    else{
+        if(value & 0x80)      { lcd->ac = value & 0x7F; lcd->cg = 0; }
+        else if(value & 0x40) { lcd->ac = value & 0x3F; lcd->cg = 1; }
+        else if(value & 0x20) { lcd->four_bit = !(value & 0x10); }
+        else if(value & 0x10) {
+            if(value & 0x08) lcd->shift += (value & 0x04) ? -1 : 1;
+            else             hd44780_step(lcd, value & 0x04);
+        }
+        else if(value & 0x08) { lcd->display = value & 0x07; }
+        else if(value & 0x04) { lcd->id = (value >> 1) & 1; lcd->sh = value & 1; }
+        else if(value & 0x02) { lcd->ac = 0; lcd->cg = 0; lcd->shift = 0; time = EXEC_LONG_NS; }
+        else if(value & 0x01) { memset(lcd->ddram, ' ', sizeof(lcd->ddram)); lcd->ac = 0; lcd->cg = 0; lcd->shift = 0; lcd->id = 1; time = EXEC_LONG_NS; }
+        lcd->commands++;
+    }
+    
+    lcd->shift = ((lcd->shift % 40) + 40) % 40;
+    lcd->busy_until  = now + time;
+    lcd->busy_total += time;
+}
+
+/* Byte the controller puts on the bus when it's read(data, or the busy flag and the address counter) */
+static inline uint8_t hd44780_read(const Hd44780 *lcd, uint64_t now, int rs){
+    if(rs) return lcd->cg ? lcd->cgram[lcd->ac & 0x3F] : lcd->ddram[lcd->ac & 0x7F];
+    return (uint8_t)(((now < lcd->busy_until) ? 0x80 : 0x00) | lcd->ac);
+}
+
+/* Runs one "EN" pulse with "nibble" on D7-D4, returns the nibble the controller drives in a read */
+static inline uint8_t hd44780_nibble(Hd44780 *lcd, uint64_t now, int rs, int rw, uint8_t nibble){
+    
+    if(!lcd->four_bit){                  //8-bit mode, D0-D3 aren't connected(read as 0)
+        uint8_t value = rw ? hd44780_read(lcd, now, rs) : (uint8_t)(nibble << 4);
+        hd44780_execute(lcd, now, rs, rw, value);
+        return value >> 4;
+    }
+    if(!lcd->half){
+        lcd->half = 1;
+        lcd->high = nibble;
+        if(rw) lcd->out = hd44780_read(lcd, now, rs);
+        return lcd->out >> 4;
+    }
+    lcd->half = 0;
+    hd44780_execute(lcd, now, rs, rw, rw ? lcd->out : (uint8_t)((lcd->high << 4) | nibble));
+    return lcd->out & 0x0F;
+}
+
+/* Character shown at a location(row and column from 0), the rows 3-4 of a 4-row LCD are the continuation of the rows 1-2 */
+static inline uint8_t hd44780_cell(const Hd44780 *lcd, int columns, int row, int column){
+    int position = column + ((row >= 2) ? columns : 0);
+    return lcd->ddram[((row & 1) ? 0x40 : 0x00) + (position + lcd->shift) % 40];
+}
+
+#endif	/* HD44780_H */
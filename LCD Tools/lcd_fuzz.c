@@ -0,0 +1,393 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Runs random sequences of library calls on the simulated HD44780 and checks
+ * the LCD against a reference model of what the calls should leave on it
+ * (DDRAM, CGRAM, cursor, display shift, display and entry mode bits), after
+ * every call. Accesses made while the LCD was still busy fail too.
+ * - The sequences are handed out in chunks to worker processes(one per
+ *   core by default) from a shared counter, so a worker that is done takes
+ *   the next chunk. All the workers stop at the first failing sequence.
+ *   The sequences per second are printed at the end
+ * - A failing sequence is made smaller(calls are left out as long as it still
+ *   fails) and printed as C code to reproduce it
+ * - Calls inside "LCD_batch_begin"/"LCD_batch_end" are checked at the end of
+ *   the batch(the LCD is allowed to be behind while a batch is open)
+ *
+ * Build: cc -std=c99 -O2 -I . -I "../LCD Single File/LCD/Header Files"
+ *           -I "../LCD Single File/LCD/Source Files" -o lcd_fuzz lcd_fuzz.c
+ * Usage: lcd_fuzz [-n sequences] [-l calls] [-j workers] [-s first seed]
+ *
+ * The library is built with R/W, the timer, calibration, batching, floats,
+ * "LCD_write_hex" and "LCD_set_character" turned on(see below), in the
+ * LCD_ROWS x LCD_COLUMNS of "LCD.h".
+ */
+
+
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE  //(MAP_ANONYMOUS)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#include "LCD.h"
+
+#undef  LCD_USE_RW
+#define LCD_USE_RW            1
+#undef  LCD_USE_TIMER
+#define LCD_USE_TIMER         1
+#undef  LCD_CALIBRATE
+#define LCD_CALIBRATE         1
+#undef  LCD_USE_BATCH
+#define LCD_USE_BATCH         1
+#undef  LCD_USE_FLOAT
+#define LCD_USE_FLOAT         1
+#undef  LCD_USE_HEX
+#define LCD_USE_HEX           1
+#undef  LCD_USE_SET_CHARACTER
+#define LCD_USE_SET_CHARACTER 1
+#undef  LCD_QUEUE_SIZE
+#define LCD_QUEUE_SIZE        0   //(Checked by "lcd_queue_test.c")
+
+#include "LCD.c"
+
+
+#define MAX_CALLS 1000
+#define MAX_TEXT  24
+#define CHUNK     64  //Sequences a worker takes from the shared counter at once
+
+enum{ CALL_CURSOR_SET, CALL_CURSOR_INCREMENT, CALL_CURSOR_DECREMENT, CALL_WRITE_CHAR, CALL_WRITE_STRING,
+      CALL_WRITE_VARIABLE, CALL_WRITE_HEX, CALL_WRITE_FLOAT, CALL_CLEAR, CALL_SHIFT_RESET, CALL_SHIFT_LEFT,
+      CALL_SHIFT_RIGHT, CALL_ENTRY_ID, CALL_ENTRY_SHIFT, CALL_LCD_DISPLAY, CALL_CURSOR_DISPLAY, CALL_CURSOR_BLINK,
+      CALL_ADD_CHARACTER, CALL_SET_CHARACTER, CALL_BATCH, CALL_COUNT };
+
+typedef struct{
+    int     call;
+    int32_t a, b, c;
+    float   f;
+    char    text[MAX_TEXT + 1];
+} Call;
+
+/* What the LCD should look like after the calls(same fields as the simulated LCD) */
+typedef struct{
+    uint8_t ddram[128];
+    uint8_t cgram[64];
+    uint8_t ac, id, sh, display;
+    int     shift;
+} Model;
+
+static uint64_t random_state;
+
+
+static uint32_t next_random(void){
+    random_state = random_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (uint32_t)(random_state >> 33);
+}
+
+static int random_below(int n){
+    return (int)(next_random() % (uint32_t)n);
+}
+
+/* A random call, with the arguments kept inside what the functions accept */
+static void random_call(Call *c){
+    
+    static const char characters[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789 .:-\x01\x02\x07\xB0\xFF";
+    
+    memset(c, 0, sizeof(*c));
+    c->call = random_below(CALL_COUNT);
+    c->a = random_below(LCD_ROWS) + 1;
+    c->b = random_below(LCD_COLUMNS) + 1;
+    c->c = random_below(2);
+    if(c->call == CALL_WRITE_VARIABLE || c->call == CALL_WRITE_HEX){
+        c->a = (int32_t)next_random() >> random_below(32);
+        c->b = random_below(12);
+    }
+    if(c->call == CALL_WRITE_FLOAT){
+        c->f = (float)((int32_t)next_random() >> random_below(32)) / (float)(1 << random_below(16));
+        c->b = random_below(14);
+        c->c = random_below(5);
+    }
+    if(c->call == CALL_ADD_CHARACTER || c->call == CALL_SET_CHARACTER) c->a = random_below(8);
+    int length = (c->call == CALL_WRITE_STRING) ? random_below(MAX_TEXT) + 1 : 8;
+    for(int i=0 ; i < length ; i++) c->text[i] = characters[random_below(sizeof(characters) - 1)];
+}
+
+/* Moves the model's address counter like the LCD does */
+static void model_step(Model *m, int increment){
+    if(increment) m->ac = (m->ac == 0x27) ? 0x40 : (m->ac == 0x67) ? 0x00 : (uint8_t)(m->ac + 1);
+    else          m->ac = (m->ac == 0x40) ? 0x27 : (m->ac == 0x00) ? 0x67 : (uint8_t)(m->ac - 1);
+}
+
+/* Writes characters on the model at the cursor */
+static void model_write(Model *m, const char *text, int length){
+    for(int i=0 ; i < length ; i++){
+        m->ddram[m->ac] = (uint8_t)text[i];
+        model_step(m, m->id);
+        if(m->sh) m->shift += m->id ? 1 : -1;
+    }
+}
+
+/* Changes the model the way the call is documented to change the LCD */
+static void model_call(Model *m, const Call *c){
+    
+    static const uint8_t row_start[4] = { 0x00, 0x40, 0x00 + LCD_COLUMNS, 0x40 + LCD_COLUMNS };
+    char text[64], digits[16];
+    int  length = 0;
+    
+    switch(c->call){
+        case CALL_CURSOR_SET:       m->ac = (uint8_t)(row_start[c->a - 1] + c->b - 1); break;
+        case CALL_CURSOR_INCREMENT: model_step(m, 1); break;
+        case CALL_CURSOR_DECREMENT: model_step(m, 0); break;
+        case CALL_WRITE_CHAR:       model_write(m, c->text, 1); break;
+        case CALL_WRITE_STRING:     model_write(m, c->text, (int)strlen(c->text)); break;
+        case CALL_WRITE_VARIABLE:
+            sprintf(digits, "%lu", (unsigned long)(c->a < 0 ? -(uint32_t)c->a : (uint32_t)c->a));  //(Negative numbers are written as positive)
+            length = sprintf(text, "%*s", (int)c->b, digits);
+            model_write(m, text, length);
+            break;
+        case CALL_WRITE_HEX:
+            length = sprintf(text, c->c ? "%0*lX" : "%*lX", c->b, (unsigned long)(uint32_t)c->a);
+            model_write(m, text, length);
+            break;
+        case CALL_WRITE_FLOAT:
+            if(!(c->f < 4294967296.0f && c->f > -4294967296.0f)) length = sprintf(text, "*");
+            else length = sprintf(text, "%*.*f", c->b, (int)c->c, (double)c->f);
+            model_write(m, text, length);
+            break;
+        case CALL_CLEAR:            memset(m->ddram, ' ', sizeof(m->ddram)); m->ac = 0; m->shift = 0; break;
+        case CALL_SHIFT_RESET:      m->ac = 0; m->shift = 0; break;
+        case CALL_SHIFT_LEFT:       m->shift++; break;
+        case CALL_SHIFT_RIGHT:      m->shift--; break;
+        case CALL_ENTRY_ID:         m->id = (uint8_t)c->c; break;
+        case CALL_ENTRY_SHIFT:      m->sh = (uint8_t)c->c; break;
+        case CALL_LCD_DISPLAY:      m->display = (uint8_t)((m->display & ~4) | (c->c << 2)); break;
+        case CALL_CURSOR_DISPLAY:   m->display = (uint8_t)((m->display & ~2) | (c->c << 1)); break;
+        case CALL_CURSOR_BLINK:     m->display = (uint8_t)((m->display & ~1) | c->c); break;
+        case CALL_ADD_CHARACTER:    memcpy(m->cgram + 8*c->a, c->text, 8); m->ac = 0; break;
+        case CALL_SET_CHARACTER:    memcpy(m->cgram + 8*c->a, c->text, 8); break;
+    }
+    m->shift = ((m->shift % 40) + 40) % 40;
+}
+
+/* Makes the library call */
+static void library_call(const Call *c){
+    switch(c->call){
+        case CALL_CURSOR_SET:       LCD_cursor_set((uint8_t)c->a, (uint8_t)c->b); break;
+        case CALL_CURSOR_INCREMENT: LCD_cursor_increment(); break;
+        case CALL_CURSOR_DECREMENT: LCD_cursor_decrement(); break;
+        case CALL_WRITE_CHAR:       LCD_write_char(c->text[0]); break;
+        case CALL_WRITE_STRING:     LCD_write_string(c->text); break;
+        case CALL_WRITE_VARIABLE:   LCD_write_variable(c->a, (uint8_t)c->b); break;
+        case CALL_WRITE_HEX:        LCD_write_hex((uint32_t)c->a, (uint8_t)c->b, (uint8_t)c->c); break;
+        case CALL_WRITE_FLOAT:      LCD_write_float(c->f, (uint8_t)c->b, (uint8_t)c->c); break;
+        case CALL_CLEAR:            LCD_clear(); break;
+        case CALL_SHIFT_RESET:      LCD_shift_reset(); break;
+        case CALL_SHIFT_LEFT:       LCD_shift_left(); break;
+        case CALL_SHIFT_RIGHT:      LCD_shift_right(); break;
+        case CALL_ENTRY_ID:         LCD_configure_entry_id((uint8_t)c->c); break;
+        case CALL_ENTRY_SHIFT:      LCD_configure_entry_shift((uint8_t)c->c); break;
+        case CALL_LCD_DISPLAY:      LCD_configure_lcd_display((uint8_t)c->c); break;
+        case CALL_CURSOR_DISPLAY:   LCD_configure_cursor_display((uint8_t)c->c); break;
+        case CALL_CURSOR_BLINK:     LCD_configure_cursor_blink((uint8_t)c->c); break;
+        case CALL_ADD_CHARACTER:    LCD_add_character(c->text, (uint8_t)c->a); break;
+        case CALL_SET_CHARACTER:    LCD_set_character(c->text, (uint8_t)c->a); break;
+        case CALL_BATCH:            if(LCD_batch_open) LCD_batch_end(); else LCD_batch_begin(); break;
+    }
+}
+
+/* Prints the call as C code */
+static void print_call(const Call *c){
+    static const char *names[] = { "LCD_cursor_set", "LCD_cursor_increment", "LCD_cursor_decrement", "LCD_write_char",
+                                   "LCD_write_string", "LCD_write_variable", "LCD_write_hex", "LCD_write_float", "LCD_clear",
+                                   "LCD_shift_reset", "LCD_shift_left", "LCD_shift_right", "LCD_configure_entry_id",
+                                   "LCD_configure_entry_shift", "LCD_configure_lcd_display", "LCD_configure_cursor_display",
+                                   "LCD_configure_cursor_blink", "LCD_add_character", "LCD_set_character", "LCD_batch_begin/end" };
+    char text[4 * MAX_TEXT + 1];
+    int  length = (c->call == CALL_WRITE_CHAR) ? 1 : (int)strlen(c->text);
+    for(int i=0, p=0 ; i <= length ; i++) p += (i < length) ? sprintf(text + p, "\\x%02X", (uint8_t)c->text[i]) : 0;
+    if(!length) text[0] = '\0';
+    printf("    %s(", names[c->call]);
+    switch(c->call){
+        case CALL_CURSOR_SET:       printf("%ld, %ld", (long)c->a, (long)c->b); break;
+        case CALL_WRITE_CHAR:       printf("'%s'", text); break;
+        case CALL_WRITE_STRING:     printf("\"%s\"", text); break;
+        case CALL_WRITE_VARIABLE:   printf("%ld, %ld", (long)c->a, (long)c->b); break;
+        case CALL_WRITE_HEX:        printf("%ld, %ld, %ld", (long)c->a, (long)c->b, (long)c->c); break;
+        case CALL_WRITE_FLOAT:      printf("%.9gf, %ld, %ld", (double)c->f, (long)c->b, (long)c->c); break;
+        case CALL_ADD_CHARACTER:
+        case CALL_SET_CHARACTER:    printf("\"%s\", %ld", text, (long)c->a); break;
+        case CALL_ENTRY_ID: case CALL_ENTRY_SHIFT: case CALL_LCD_DISPLAY: case CALL_CURSOR_DISPLAY:
+        case CALL_CURSOR_BLINK:     printf("%ld", (long)c->c); break;
+    }
+    printf(");\n");
+}
+
+/* Runs the calls from a fresh start, returns the number of the call after which the LCD was wrong(-1 if none) */
+static int run(const Call *calls, int count, char *why){
+    
+    Model m;
+    memset(&m, 0, sizeof(m));
+    memset(m.ddram, ' ', sizeof(m.ddram));
+    m.id = 1;
+    m.display = 0b100;
+    
+    host_reset();
+    LCD_mode       = LCD_MODE_DEFAULT;
+    LCD_ready_at   = 0;
+    LCD_batch_open = 0;
+    LCD_init();
+    
+    for(int i=0 ; i <= count ; i++){
+        if(i == count){                                   //(Close a batch left open)
+            if(!LCD_batch_open) break;
+            LCD_batch_end();
+        }
+        else{
+            library_call(&calls[i]);
+            model_call(&m, &calls[i]);
+            if(LCD_batch_open) continue;
+        }
+        
+        const Hd44780 *l = &host_lcd;
+        const char *wrong = NULL;
+        for(int a=0 ; a < 0x68 && !wrong ; a++){
+            if((a < 0x28 || a >= 0x40) && l->ddram[a] != m.ddram[a]) wrong = "DDRAM";
+        }
+        if(!wrong && memcmp(l->cgram, m.cgram, sizeof(m.cgram))) wrong = "CGRAM";
+        if(!wrong && (l->cg || l->ac != m.ac))                  wrong = "cursor";
+        if(!wrong && l->shift != m.shift)                       wrong = "display shift";
+        if(!wrong && (l->id != m.id || l->sh != m.sh))          wrong = "entry mode";
+        if(!wrong && l->display != m.display)                   wrong = "display control";
+        if(!wrong && l->early)                                  wrong = "access while the LCD was busy";
+        if(wrong){
+            if(why) strcpy(why, wrong);
+            return (i < count) ? i : count - 1;
+        }
+    }
+    return -1;
+}
+
+/* Makes the calls of a seed */
+static int make_calls(uint64_t seed, int length, Call *calls){
+    random_state = seed * 0x9E3779B97F4A7C15ULL + 1;
+    int count = random_below(length) + 1;
+    for(int i=0 ; i < count ; i++) random_call(&calls[i]);
+    return count;
+}
+
+
+int main(int argc, char **argv){
+    
+    long     sequences = 100000;
+    int      length    = 200;
+    int      workers   = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    uint64_t first     = 1;
+    
+    /*---------- Read the arguments ----------*/
+    for(int i=1 ; i < argc ; i++){
+        if     (!strcmp(argv[i], "-n") && i+1 < argc) sequences = atol(argv[++i]);
+        else if(!strcmp(argv[i], "-l") && i+1 < argc) length    = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-j") && i+1 < argc) workers   = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-s") && i+1 < argc) first     = strtoull(argv[++i], NULL, 10);
+        else{
+            fprintf(stderr, "usage: %s [-n sequences] [-l calls] [-j workers] [-s first seed]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(length < 1 || length > MAX_CALLS) length = (length < 1) ? 1 : MAX_CALLS;
+    if(workers < 1) workers = 1;
+    
+    /*---------- Run the seeds in the workers(chunks from the shared counter, the first failing seed stops all) ----------*/
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    struct{ long next; uint64_t failed; } *shared;     //Next sequence to hand out, first failing seed(0 if none)
+    shared = mmap(NULL, sizeof(*shared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if(shared == MAP_FAILED){ perror("mmap"); return 1; }
+    shared->next   = 0;
+    shared->failed = 0;
+    for(int w=0 ; w < workers ; w++){
+        pid_t pid = fork();
+        if(pid < 0){ perror("fork"); if(!w) return 1; break; }
+        if(pid) continue;
+        static Call calls[MAX_CALLS];
+        while(!__atomic_load_n(&shared->failed, __ATOMIC_RELAXED)){
+            long n = __atomic_fetch_add(&shared->next, CHUNK, __ATOMIC_RELAXED);
+            if(n >= sequences) break;
+            for(long last = (n + CHUNK < sequences) ? (n + CHUNK) : sequences ; n < last ; n++){
+                uint64_t seed = first + (uint64_t)n, none = 0;
+                int count = make_calls(seed, length, calls);
+                if(run(calls, count, NULL) >= 0){
+                    __atomic_compare_exchange_n(&shared->failed, &none, seed, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+                }
+                if(__atomic_load_n(&shared->failed, __ATOMIC_RELAXED)) break;  //(Found here or by another worker)
+            }
+        }
+        _exit(0);
+    }
+    while(wait(NULL) > 0);
+    uint64_t failed = shared->failed;
+    munmap(shared, sizeof(*shared));
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds = (double)(end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    
+    if(!failed){
+        printf("%ld sequences(max. %d calls) passed in %.1f s with %d workers, %.0f sequences/s\n",
+               sequences, length, seconds, workers, sequences / seconds);
+        return 0;
+    }
+    
+    /*---------- Make the failing sequence smaller: leave out calls while it still fails ----------*/
+    static Call calls[MAX_CALLS], trial[MAX_CALLS];
+    char why[64];
+    int count = make_calls(failed, length, calls);
+    count = run(calls, count, why) + 1;                   //(The calls after the failure don't matter)
+    for(int chunk = count / 2 ; chunk >= 1 ; chunk /= 2){
+        for(int i=0 ; i + chunk <= count ; ){
+            memcpy(trial, calls, i * sizeof(Call));
+            memcpy(trial + i, calls + i + chunk, (count - i - chunk) * sizeof(Call));
+            int at = run(trial, count - chunk, NULL);
+            if(at >= 0){
+                count = at + 1;
+                memcpy(calls, trial, count * sizeof(Call));
+            }
+            else i++;
+        }
+    }
+    run(calls, count, why);
+    printf("seed %llu fails(%s wrong), smallest sequence found(after LCD_init):\n", (unsigned long long)failed, why);
+    for(int i=0 ; i < count ; i++) print_call(&calls[i]);
+    return 1;
+}
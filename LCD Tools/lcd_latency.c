@@ -0,0 +1,157 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+/*
+ * Measures how long a character posted by an interrupt("LCD_post_char")
+ * waits before it's on the LCD, while the main code keeps writing rows
+ * of text and calls "LCD_drain" after each row(like a main loop would).
+ * Build it once with -DURGENT=1 and once with -DURGENT=0 to compare
+ * "LCD_QUEUE_URGENT" settings:
+ * - Latency: from "LCD_post_char" to the character being in the DDRAM
+ *   (min./average/max. and the 99th percentile)
+ * - Main code: characters per second written by the main loop(the time
+ *   the queue takes from it)
+ *
+ * Build: cc -std=c99 -O2 -I . -I "../LCD Single File/LCD/Header Files"
+ *           -I "../LCD Single File/LCD/Source Files" -DURGENT=1 -o lcd_latency lcd_latency.c
+ * Usage: lcd_latency [-n characters] [-w characters written between "LCD_drain" calls]
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "LCD.h"
+
+#ifndef URGENT
+#define URGENT 1
+#endif
+
+#undef  LCD_USE_TIMER
+#define LCD_USE_TIMER    1
+#undef  LCD_USE_BATCH
+#define LCD_USE_BATCH    0
+#undef  LCD_ROWS
+#define LCD_ROWS         4
+#undef  LCD_COLUMNS
+#define LCD_COLUMNS      20
+#undef  LCD_QUEUE_SIZE
+#define LCD_QUEUE_SIZE   16
+#undef  LCD_QUEUE_URGENT
+#define LCD_QUEUE_URGENT URGENT
+
+#include "LCD.c"
+
+
+#define MAX_POSTS 100000
+
+static uint64_t random_state;
+static long     posts, wanted;          //Characters measured so far/to be measured
+static uint32_t latency[MAX_POSTS];     //[uS]
+static uint8_t  pending;                //DDRAM address of the character on its way(0 if none)
+static uint8_t  pending_character;
+static uint64_t posted_at, next_post;   //[nS]
+
+
+static uint32_t next_random(void){
+    random_state = random_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (uint32_t)(random_state >> 33);
+}
+
+/* Runs every uS: notices the posted character landing, posts the next one 0-2 mS later */
+static void interrupt(void){
+    
+    if(pending && host_lcd.ddram[pending] == pending_character){
+        latency[posts++] = (uint32_t)((host_now - posted_at) / 1000);
+        pending   = 0;
+        next_post = host_now + (uint64_t)(next_random() % 2000) * 1000;
+    }
+    if(!pending && posts < wanted && host_now >= next_post){
+        uint8_t column = (uint8_t)(next_random() % LCD_COLUMNS + 1);
+        pending = (uint8_t)(0x40 + LCD_COLUMNS + column - 1);
+        pending_character = (host_lcd.ddram[pending] == '*') ? '#' : '*';  //(Different from what the cell has)
+        LCD_post_char(4, column, (char)pending_character);
+        posted_at = host_now;
+    }
+    
+    host_interrupt    = interrupt;
+    host_interrupt_at = host_now + 1000;
+}
+
+static int compare(const void *a, const void *b){
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+
+int main(int argc, char **argv){
+    
+    int width = LCD_COLUMNS;
+    wanted = 10000;
+    
+    for(int i=1 ; i < argc ; i++){
+        if     (!strcmp(argv[i], "-n") && i+1 < argc) wanted = atol(argv[++i]);
+        else if(!strcmp(argv[i], "-w") && i+1 < argc) width  = atoi(argv[++i]);
+        else{
+            fprintf(stderr, "usage: %s [-n characters] [-w characters written between \"LCD_drain\" calls]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(wanted < 1 || wanted > MAX_POSTS) wanted = (wanted < 1) ? 1 : MAX_POSTS;
+    if(width < 1 || width > 3 * LCD_COLUMNS) width = (width < 1) ? 1 : 3 * LCD_COLUMNS;
+    
+    /*---------- Main loop: rows 1-3 are rewritten over and over ----------*/
+    char text[3 * LCD_COLUMNS + 1];
+    long written = 0;
+    
+    host_reset();
+    LCD_init();
+    uint64_t start = host_now;
+    host_interrupt    = interrupt;
+    host_interrupt_at = host_now;
+    
+    while(posts < wanted){
+        for(int i=0 ; i < width ; i++) text[i] = (char)('A' + (written + i) % 26);
+        text[width] = '\0';
+        LCD_cursor_set(1, 1);
+        LCD_write_string(text);                           //(Rows 1 and 3 continue into each other, row 2 after them)
+        written += width;
+        LCD_drain();
+    }
+    
+    /*---------- Report ----------*/
+    double seconds = (double)(host_now - start) / 1e9;
+    double sum = 0;
+    qsort(latency, (size_t)posts, sizeof(latency[0]), compare);
+    for(long i=0 ; i < posts ; i++) sum += latency[i];
+    printf("LCD_QUEUE_URGENT %d, %d characters between \"LCD_drain\" calls:\n", URGENT, width);
+    printf("  latency: min. %lu uS, average %.0f uS, 99%% %lu uS, max. %lu uS(%ld characters)\n",
+           (unsigned long)latency[0], sum / posts, (unsigned long)latency[posts * 99 / 100], (unsigned long)latency[posts - 1], posts);
+    printf("  main code: %.0f characters/s\n", written / seconds);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,482 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Compiles screen layouts written in a text file into bytecode for
+ * "LCD_exec", using as few bus bytes(and then program memory bytes) as it can:
+ * - DDRAM addresses are calculated here, the LCD only gets "LCD_OP_ADDRESS"
+ * - Cells are written in DDRAM order so auto-increment carries the cursor,
+ *   also from line 1 into line 3 and from line 3 into line 2 on 4x20
+ * - A 1 cell gap that is known to be empty is written over instead of
+ *   setting the cursor again(same bus bytes, less program memory)
+ * - Long runs of the same character become "LCD_OP_FILL"
+ * - Custom characters become "LCD_OP_GLYPH" with the 8 pattern bytes, which
+ *   "LCD_set_character" reads straight from program memory
+ *
+ * Build: cc -std=c99 -O2 -o lcd_layout lcd_layout.c
+ * Usage: lcd_layout screens.txt [-o screens.c] [-H screens.h]
+ *
+ * Layout file(one command per line, '#' starts a comment):
+ *   size 4 20                     Rows and columns of the LCD(before the screens)
+ *   screen main                   Starts a screen, compiled into "const uint8_t LCD_screen_main[]"
+ *   clear                         Clears the screen first(only the non-empty cells are written then)
+ *   mode display increment        Sets the mode: display, cursor, blink, increment, shift(the
+ *                                 screen itself is always written with increment and no shift,
+ *                                 "LCD_exec" sets the entry bits after the last character)
+ *   glyph 0                       Custom character at CGRAM location 0-7, followed by
+ *   .#.#.                         8 lines of 5 pixels('#' is on, anything else is off)
+ *   row 1 "Temp:"                 Text from the first column of a row
+ *   text 2 3 "\x01 ok"            Text from a column(\0-\7 are custom characters, \xHH any code)
+ *   field 1 7 6 1 temp            Value slot at row 1, column 7, 6 wide, 1 fractional digit
+ *                                 (slots are numbered 0, 1.. in order, the name is optional and
+ *                                 becomes "LCD_VALUE_MAIN_TEMP" in the header)
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+
+
+#define LCD_OP_END     0x00  //(Same as "LCD.h")
+#define LCD_OP_ADDRESS 0x01
+#define LCD_OP_WRITE   0x02
+#define LCD_OP_FILL    0x03
+#define LCD_OP_GLYPH   0x04
+#define LCD_OP_CONFIG  0x05
+#define LCD_OP_CLEAR   0x06
+#define LCD_OP_VALUE   0x07
+
+#define CELL_UNTOUCHED -1  //Cell isn't part of the screen, its content is unknown
+#define CELL_FIELD     -2  //Cell belongs to a field
+
+#define MAX_FIELDS 32
+#define MAX_CODE   4096
+
+
+typedef struct{
+    char    name[32];
+    int     clear;
+    int     mode;          //-1 if not set
+    int     glyph_used[8];
+    uint8_t glyph[8][8];
+    int     cell[4][40];   //Character of each cell, or CELL_...
+    int     field_count;
+    int     field_row[MAX_FIELDS], field_column[MAX_FIELDS], field_width[MAX_FIELDS], field_f_digit[MAX_FIELDS];
+    char    field_name[MAX_FIELDS][32];
+} Screen;
+
+static int rows = 4, columns = 20;
+static int line_number;
+static const char *file_name;
+
+
+static void fail(const char *message){
+    fprintf(stderr, "%s:%d: %s\n", file_name, line_number, message);
+    exit(1);
+}
+
+/* DDRAM address of a cell(rows 3-4 are the continuation of rows 1-2) */
+static int address_of(int row, int column){
+    return ((row & 1) ? 0x40 : 0x00) + ((row >= 2) ? columns : 0) + column;
+}
+
+/* Address the cursor moves to after writing a cell */
+static int next_address(int address){
+    if(address == 0x27) return 0x40;  //End of line 1 continues from line 2
+    if(address == 0x67) return 0x00;
+    return address + 1;
+}
+
+/* Parses a quoted string with C-like escapes, returns the number of characters */
+static int parse_string(const char *p, int *out, int max){
+    
+    int length = 0;
+    while(*p && *p != '"') p++;
+    if(*p++ != '"') fail("expected a quoted string");
+    while(*p && *p != '"'){
+        int c = (unsigned char)*p++;
+        if(c == '\\'){
+            c = (unsigned char)*p++;
+            if(c >= '0' && c <= '7') c -= '0';
+            else if(c == 'x'){
+                char *end;
+                c = (int)strtol(p, &end, 16);
+                if(end == p || c > 0xFF) fail("bad \\x escape");
+                p = end;
+            }
+            else if(c != '\\' && c != '"') fail("unknown escape");
+        }
+        if(length == max) fail("text doesn't fit in the row");
+        out[length++] = c;
+    }
+    if(*p != '"') fail("missing closing quote");
+    return length;
+}
+
+/* Appends a byte to the program */
+static void emit(uint8_t *code, int *size, int value){
+    if(*size == MAX_CODE) fail("screen too long");
+    code[(*size)++] = (uint8_t)value;
+}
+
+/* Compiles a screen, returns the program size and the bus bytes it costs */
+static int compile(const Screen *s, uint8_t *code, int *bus){
+    
+    int size   = 0;
+    int cursor = -1;  //Address the LCD's cursor points to(-1 if unknown)
+    int order_row[80], order_column[80], order_count = 0;
+    
+    *bus = 0;
+    
+    /*---------- Setup: clear, mode and the custom characters ----------*/
+    if(s->clear)      { emit(code, &size, LCD_OP_CLEAR); *bus += 1; cursor = 0x00; }
+    if(s->mode >= 0)  { emit(code, &size, LCD_OP_CONFIG); emit(code, &size, s->mode); *bus += 2; }
+    for(int g=0 ; g < 8 ; g++){
+        if(!s->glyph_used[g]) continue;
+        emit(code, &size, LCD_OP_GLYPH);
+        emit(code, &size, g);
+        for(int i=0 ; i < 8 ; i++) emit(code, &size, s->glyph[g][i]);
+        *bus += 10;
+    }
+    
+    /*---------- Put the visible cells in DDRAM order(the order auto-increment goes in) ----------*/
+    for(int address=0 ; address < 0x80 ; address++){
+        for(int r=0 ; r < rows ; r++){
+            for(int c=0 ; c < columns ; c++){
+                if(address_of(r, c) != address) continue;
+                order_row[order_count] = r;
+                order_column[order_count] = c;
+                order_count++;
+            }
+        }
+    }
+    
+    /*---------- Walk the cells, keeping track of where the cursor is ----------*/
+    int run = -1;  //Position of the length byte of the open "LCD_OP_WRITE"(-1 if none)
+    for(int i=0 ; i < order_count ; i++){
+        
+        int r = order_row[i], c = order_column[i];
+        int address = address_of(r, c);
+        int value = s->cell[r][c];
+        int field = -1;
+        
+        if(value == CELL_UNTOUCHED) continue;
+        if(value == CELL_FIELD){
+            for(int f=0 ; f < s->field_count ; f++){
+                if(s->field_row[f] == r && s->field_column[f] == c) field = f;
+            }
+            if(field < 0) continue;  //Not the first cell of the field
+        }
+        if(s->clear && value == ' ') continue;  //Already empty
+        
+        /* Move the cursor: write over a single known-empty cell, otherwise set the address */
+        if(cursor != address){
+            int previous = i - 1;  //(Cell the cursor is at if the gap is 1 cell)
+            if(s->clear && previous >= 0 && next_address(cursor) == address
+               && address_of(order_row[previous], order_column[previous]) == cursor
+               && s->cell[order_row[previous]][order_column[previous]] == ' '){
+                if(run < 0 || code[run] == 255){
+                    emit(code, &size, LCD_OP_WRITE);
+                    run = size;
+                    emit(code, &size, 0);
+                }
+                emit(code, &size, ' ');
+                code[run]++;
+                *bus += 1;
+            }
+            else{
+                emit(code, &size, LCD_OP_ADDRESS);
+                emit(code, &size, address);
+                *bus += 1;
+                run = -1;
+            }
+        }
+        
+        if(field >= 0){
+            emit(code, &size, LCD_OP_VALUE);
+            emit(code, &size, field);
+            emit(code, &size, s->field_width[field]);
+            emit(code, &size, s->field_f_digit[field]);
+            *bus  += s->field_width[field];
+            cursor = next_address(address_of(r, c + s->field_width[field] - 1));
+            run    = -1;
+        }
+        else{
+            if(run < 0 || code[run] == 255){
+                emit(code, &size, LCD_OP_WRITE);
+                run = size;
+                emit(code, &size, 0);
+            }
+            emit(code, &size, value);
+            code[run]++;
+            *bus  += 1;
+            cursor = next_address(address);
+        }
+    }
+    emit(code, &size, LCD_OP_END);
+    
+    /*---------- Turn long runs of the same character into "LCD_OP_FILL" ----------*/
+    uint8_t packed[MAX_CODE];
+    int p = 0;
+    for(int i=0 ; i < size ; ){
+        int op = code[i];
+        int length = (op == LCD_OP_WRITE) ? 2 + code[i+1] : (op == LCD_OP_GLYPH) ? 10 : (op == LCD_OP_VALUE) ? 4 :
+                     (op == LCD_OP_ADDRESS || op == LCD_OP_CONFIG) ? 2 : 1;
+        if(op != LCD_OP_WRITE){
+            memcpy(packed + p, code + i, length);
+            p += length;
+            i += length;
+            continue;
+        }
+        const uint8_t *text = code + i + 2;
+        int count = code[i+1];
+        int start = 0;  //First character not written yet
+        for(int j=0 ; j < count ; ){
+            int k = j;
+            while(k < count && text[k] == text[j]) k++;
+            int repeat = k - j;
+            int cost   = 3 + ((k < count) ? 2 : 0);  //FILL, plus a new WRITE after it
+            if(repeat > cost){
+                if(j > start){
+                    packed[p++] = LCD_OP_WRITE;
+                    packed[p++] = (uint8_t)(j - start);
+                    memcpy(packed + p, text + start, j - start);
+                    p += j - start;
+                }
+                packed[p++] = LCD_OP_FILL;
+                packed[p++] = (uint8_t)repeat;
+                packed[p++] = text[j];
+                start = k;
+            }
+            j = k;
+        }
+        if(count > start){
+            packed[p++] = LCD_OP_WRITE;
+            packed[p++] = (uint8_t)(count - start);
+            memcpy(packed + p, text + start, count - start);
+            p += count - start;
+        }
+        i += length;
+    }
+    memcpy(code, packed, p);
+    return p;
+}
+
+/* Writes a program as a C array */
+static void write_program(FILE *out, const Screen *s, const uint8_t *code, int size, int bus){
+    
+    static const char *names[] = { "LCD_OP_END", "LCD_OP_ADDRESS", "LCD_OP_WRITE", "LCD_OP_FILL",
+                                   "LCD_OP_GLYPH", "LCD_OP_CONFIG", "LCD_OP_CLEAR", "LCD_OP_VALUE" };
+    
+    fprintf(out, "/* %d bytes, %d bus bytes */\n", size, bus);
+    fprintf(out, "const uint8_t LCD_screen_%s[] = {\n", s->name);
+    for(int i=0 ; i < size ; ){
+        int op = code[i];
+        int operands = (op == LCD_OP_WRITE) ? 1 + code[i+1] : (op == LCD_OP_FILL) ? 2 : (op == LCD_OP_GLYPH) ? 9 :
+                       (op == LCD_OP_VALUE) ? 3 : (op == LCD_OP_ADDRESS || op == LCD_OP_CONFIG) ? 1 : 0;
+        fprintf(out, "    %s", names[op]);
+        for(int j=1 ; j <= operands ; j++){
+            int value = code[i+j];
+            int is_text = (op == LCD_OP_WRITE && j > 1) || (op == LCD_OP_FILL && j == 2);
+            if(is_text && value >= 0x20 && value < 0x7F && value != '\'' && value != '\\') fprintf(out, ", '%c'", value);
+            else if(op == LCD_OP_GLYPH && j > 1)                                         fprintf(out, ", 0b%d%d%d%d%d", (value>>4)&1, (value>>3)&1, (value>>2)&1, (value>>1)&1, value&1);
+            else if(is_text || op == LCD_OP_ADDRESS || op == LCD_OP_CONFIG)               fprintf(out, ", 0x%02X", value);
+            else                                                                        fprintf(out, ", %d", value);
+        }
+        i += 1 + operands;
+        fprintf(out, (i < size) ? ",\n" : "\n");
+    }
+    fprintf(out, "};\n\n");
+}
+
+
+int main(int argc, char **argv){
+    
+    const char *c_name = NULL, *h_name = NULL;
+    
+    /*---------- Read the arguments ----------*/
+    for(int i=1 ; i < argc ; i++){
+        if     (!strcmp(argv[i], "-o") && i+1 < argc) c_name = argv[++i];
+        else if(!strcmp(argv[i], "-H") && i+1 < argc) h_name = argv[++i];
+        else if(argv[i][0] != '-' && !file_name)     file_name = argv[i];
+        else{
+            file_name = NULL;
+            break;
+        }
+    }
+    if(!file_name){
+        fprintf(stderr, "usage: %s screens.txt [-o screens.c] [-H screens.h]\n", argv[0]);
+        return 2;
+    }
+    FILE *in = fopen(file_name, "r");
+    if(!in){ perror(file_name); return 1; }
+    FILE *out = c_name ? fopen(c_name, "w") : stdout;
+    FILE *header = h_name ? fopen(h_name, "w") : NULL;
+    if(!out || (h_name && !header)){ perror(c_name && !out ? c_name : h_name); return 1; }
+    
+    fprintf(out, "/* Generated by lcd_layout from \"%s\", don't edit */\n\n#include \"LCD.h\"\n\n", file_name);
+    if(header) fprintf(header, "/* Generated by lcd_layout from \"%s\", don't edit */\n\n#include <stdint.h>\n\n", file_name);
+    
+    /*---------- Read the layout line by line ----------*/
+    static Screen s;
+    static uint8_t code[MAX_CODE];
+    char line[512];
+    int open = 0, glyph = -1, glyph_line = 0;
+    int total = 0, total_bus = 0, naive_bus = 0, screen_naive = 0;
+    for(int done = 0 ; !done ; ){
+        
+        char word[32] = "";
+        if(fgets(line, sizeof(line), in)){
+            line_number++;
+            if(glyph >= 0){  //Pixels of a custom character
+                char *p = line;
+                while(isspace((unsigned char)*p)) p++;
+                if(!*p) continue;
+                uint8_t bits = 0;
+                for(int i=0 ; i < 5 ; i++){
+                    if(!p[i] || isspace((unsigned char)p[i])) fail("glyph rows need 5 pixels");
+                    bits = (uint8_t)((bits << 1) | (p[i] == '#'));
+                }
+                s.glyph[glyph][glyph_line++] = bits;
+                if(glyph_line == 8) glyph = -1;
+                continue;
+            }
+            char *hash = strchr(line, '#');
+            if(hash && !strchr(line, '"')) *hash = '\0';
+            if(sscanf(line, "%31s", word) != 1) continue;
+        }
+        else{
+            if(glyph >= 0) fail("glyph needs 8 rows");
+            done = 1;
+        }
+        
+        /* Finish the previous screen */
+        if(open && (done || !strcmp(word, "screen"))){
+            int bus;
+            int size = compile(&s, code, &bus);
+            write_program(out, &s, code, size, bus);
+            if(header){
+                fprintf(header, "extern const uint8_t LCD_screen_%s[];\n", s.name);
+                for(int f=0 ; f < s.field_count ; f++){
+                    if(!s.field_name[f][0]) continue;
+                    fprintf(header, "#define LCD_VALUE_");
+                    for(char *n = s.name ; *n ; n++) fputc(toupper((unsigned char)*n), header);
+                    fputc('_', header);
+                    for(char *n = s.field_name[f] ; *n ; n++) fputc(toupper((unsigned char)*n), header);
+                    fprintf(header, " %d\n", f);
+                }
+            }
+            fprintf(stderr, "%s: %d bytes, %d bus bytes(%d with a cursor set and write for each text)\n",
+                    s.name, size, bus, screen_naive);
+            total += size; total_bus += bus; naive_bus += screen_naive;
+            open = 0;
+        }
+        if(done) break;
+        
+        int a, b, c, d;
+        char name[32] = "";
+        int text[40];
+        if(!strcmp(word, "size")){
+            if(sscanf(line, "%*s %d %d", &rows, &columns) != 2 || rows < 1 || rows > 4 || columns < 1 || columns > 40
+               || (rows > 2 && columns > 20)) fail("bad size");
+        }
+        else if(!strcmp(word, "screen")){
+            memset(&s, 0, sizeof(s));
+            for(int r=0 ; r < 4 ; r++) for(int col=0 ; col < 40 ; col++) s.cell[r][col] = CELL_UNTOUCHED;
+            s.mode = -1;
+            if(sscanf(line, "%*s %31s", s.name) != 1) fail("screen needs a name");
+            for(char *n = s.name ; *n ; n++) if(!isalnum((unsigned char)*n) && *n != '_') fail("screen names are C identifiers");
+            screen_naive = 0;
+            open = 1;
+        }
+        else if(!open){
+            fail("expected \"screen\"");
+        }
+        else if(!strcmp(word, "clear")){
+            s.clear = 1;
+            screen_naive += 1;
+            for(int r=0 ; r < rows ; r++) for(int col=0 ; col < columns ; col++) if(s.cell[r][col] == CELL_UNTOUCHED) s.cell[r][col] = ' ';
+        }
+        else if(!strcmp(word, "mode")){
+            static const char *bits[] = { "blink", "cursor", "display", "shift", "increment" };
+            s.mode = 0;
+            for(char *p = strtok(strstr(line, word) + strlen(word), " \t\r\n") ; p ; p = strtok(NULL, " \t\r\n")){
+                int found = 0;
+                for(int i=0 ; i < 5 ; i++) if(!strcmp(p, bits[i])){ s.mode |= 1 << i; found = 1; }
+                if(!found) fail("unknown mode");
+            }
+            screen_naive += 2;
+        }
+        else if(!strcmp(word, "glyph")){
+            if(sscanf(line, "%*s %d", &a) != 1 || a < 0 || a > 7) fail("glyph location is 0-7");
+            s.glyph_used[a] = 1;
+            glyph = a;
+            glyph_line = 0;
+            screen_naive += 10;
+        }
+        else if(!strcmp(word, "row") || !strcmp(word, "text")){
+            int is_row = !strcmp(word, "row");
+            if(is_row ? sscanf(line, "%*s %d", &a) != 1 : sscanf(line, "%*s %d %d", &a, &b) != 2) fail("bad position");
+            if(is_row) b = 1;
+            if(a < 1 || a > rows || b < 1 || b > columns) fail("position is outside the screen");
+            int length = parse_string(line, text, columns - b + 1);
+            for(int i=0 ; i < length ; i++){
+                if(s.cell[a-1][b-1+i] == CELL_FIELD) fail("text overlaps a field");
+                s.cell[a-1][b-1+i] = text[i];
+            }
+            screen_naive += 1 + length;
+        }
+        else if(!strcmp(word, "field")){
+            if(sscanf(line, "%*s %d %d %d %d %31s", &a, &b, &c, &d, name) < 4) fail("field needs row, column, width and f_digit");
+            if(a < 1 || a > rows || b < 1 || c < 1 || b + c - 1 > columns) fail("field is outside the screen");
+            if(c > 12) fail("fields are max. 12 wide");
+            if(s.field_count == MAX_FIELDS) fail("too many fields");
+            for(int i=0 ; i < c ; i++){
+                int cell = s.cell[a-1][b-1+i];
+                if(cell != CELL_UNTOUCHED && !(s.clear && cell == ' ')) fail("field overlaps text or another field");
+                s.cell[a-1][b-1+i] = CELL_FIELD;
+            }
+            s.field_row[s.field_count] = a - 1;
+            s.field_column[s.field_count] = b - 1;
+            s.field_width[s.field_count] = c;
+            s.field_f_digit[s.field_count] = d;
+            strcpy(s.field_name[s.field_count], name);
+            s.field_count++;
+            screen_naive += 1 + c;
+        }
+        else{
+            fail("unknown command");
+        }
+    }
+    
+    fprintf(stderr, "total: %d bytes, %d bus bytes(%d with a cursor set and write for each text)\n", total, total_bus, naive_bus);
+    fclose(in);
+    if(c_name) fclose(out);
+    if(header) fclose(header);
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+/*
+ * Stress test of the character queue: an interrupt posts characters with
+ * "LCD_post_char"/"LCD_post_string" at random times(also between the two
+ * nibbles of a byte) while the main code writes strings in random entry
+ * modes and calls "LCD_drain". Row 4 belongs to the interrupt, rows 1-3 to
+ * the main code, so the final screen is known:
+ * - Every accepted character has to be on row 4, every string on its row
+ * - The entry mode, the cursor and the display shift have to be where the
+ *   main code left them(the queue isn't allowed to change them)
+ * - No access is allowed while the LCD is still busy
+ *
+ * Build: cc -std=c99 -O2 -I . -I "../LCD Single File/LCD/Header Files"
+ *           -I "../LCD Single File/LCD/Source Files" -o lcd_queue_test lcd_queue_test.c
+ *        (add -DURGENT=0 to test "LCD_QUEUE_URGENT" 0, only "LCD_drain" sends)
+ * Usage: lcd_queue_test [-n rounds] [-s first seed]
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "LCD.h"
+
+#ifndef URGENT
+#define URGENT 1
+#endif
+
+#undef  LCD_USE_TIMER
+#define LCD_USE_TIMER    1
+#undef  LCD_USE_BATCH
+#define LCD_USE_BATCH    1
+#undef  LCD_ROWS
+#define LCD_ROWS         4
+#undef  LCD_COLUMNS
+#define LCD_COLUMNS      20
+#undef  LCD_QUEUE_SIZE
+#define LCD_QUEUE_SIZE   16
+#undef  LCD_QUEUE_URGENT
+#define LCD_QUEUE_URGENT URGENT
+
+#include "LCD.c"
+
+
+#define ROW_4 (0x40 + LCD_COLUMNS)  //DDRAM address of row 4
+
+static const uint8_t row_start[3] = { 0x00, 0x40, 0x00 + LCD_COLUMNS };
+
+static uint64_t random_state;
+static uint8_t  expected[128];      //What the DDRAM should hold
+static int      posting;            //The interrupt keeps posting while this is set
+static long     posted, refused;    //Characters accepted/refused by the queue
+
+
+static uint32_t next_random(void){
+    random_state = random_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (uint32_t)(random_state >> 33);
+}
+
+static int random_below(int n){
+    return (int)(next_random() % (uint32_t)n);
+}
+
+/* The interrupt: posts 1-4 characters on row 4, then sets itself again 2-300 uS later */
+static void interrupt(void){
+    
+    char    text[5];
+    uint8_t column = (uint8_t)(random_below(LCD_COLUMNS) + 1);
+    int     length = random_below(4) + 1;
+    
+    if(column + length - 1 > LCD_COLUMNS) length = LCD_COLUMNS - column + 1;
+    for(int i=0 ; i < length ; i++) text[i] = (char)('a' + random_below(26));
+    text[length] = '\0';
+    
+    int count = (length == 1) ? LCD_post_char(4, column, text[0]) : LCD_post_string(4, column, text);
+    for(int i=0 ; i < count ; i++) expected[ROW_4 + column - 1 + i] = (uint8_t)text[i];
+    posted  += count;
+    refused += length - count;
+    
+    if(posting){
+        host_interrupt    = interrupt;
+        host_interrupt_at = host_now + (uint64_t)(random_below(300) + 2) * 1000;
+    }
+}
+
+/* One round: returns NULL if the LCD ended up right, what was wrong otherwise */
+static const char* round_run(uint64_t seed){
+    
+    uint8_t ac = 0, id = 1, sh = 0;  //Where the main code left the LCD
+    int     shift = 0;
+    
+    random_state = seed * 0x9E3779B97F4A7C15ULL + 1;
+    memset(expected, ' ', sizeof(expected));
+    
+    host_reset();
+    LCD_mode       = LCD_MODE_DEFAULT;
+    LCD_ready_at   = 0;
+    LCD_batch_open = 0;
+    LCD_queue_head = LCD_queue_tail = 0;
+    LCD_init();
+    
+    posting = 1;
+    host_interrupt    = interrupt;
+    host_interrupt_at = host_now + (uint64_t)random_below(300) * 1000;
+    
+    for(int n = random_below(60) + 1 ; n > 0 ; n--){
+        
+        int what = random_below(8);
+        
+        if(what == 0){                                        //Entry mode
+            id = (uint8_t)random_below(2);
+            sh = (uint8_t)(random_below(4) == 0);
+            LCD_configure_entry_id(id);
+            LCD_configure_entry_shift(sh);
+        }
+        else if(what == 1){                                   //Drain
+            LCD_drain();
+        }
+        else{                                                 //String on rows 1-3(optionally in a batch)
+            char text[LCD_COLUMNS + 1];
+            int  length = random_below(LCD_COLUMNS) + 1;
+            int  row    = random_below(3);
+            int  column = id ? random_below(LCD_COLUMNS - length + 1) : length - 1 + random_below(LCD_COLUMNS - length + 1);
+            for(int i=0 ; i < length ; i++) text[i] = (char)('A' + random_below(26));
+            text[length] = '\0';
+            
+            int batch = (random_below(4) == 0);
+            if(batch) LCD_batch_begin();
+            LCD_cursor_set((uint8_t)(row + 1), (uint8_t)(column + 1));
+            LCD_write_string(text);
+            if(batch) LCD_batch_end();
+            
+            ac = (uint8_t)(row_start[row] + column);
+            for(int i=0 ; i < length ; i++){
+                expected[ac] = (uint8_t)text[i];
+                if(id) ac = (ac == 0x27) ? 0x40 : (ac == 0x67) ? 0x00 : (uint8_t)(ac + 1);  //(Moves like the LCD's address counter)
+                else   ac = (ac == 0x40) ? 0x27 : (ac == 0x00) ? 0x67 : (uint8_t)(ac - 1);
+                if(sh) shift = (shift + (id ? 1 : 39)) % 40;
+            }
+        }
+    }
+    
+    /* Stop the interrupt and send what's left in the queue */
+    posting = 0;
+    host_interrupt = NULL;
+    LCD_drain();
+    
+    const Hd44780 *l = &host_lcd;
+    for(int a=0 ; a < 0x68 ; a++){
+        if((a < 0x28 || a >= 0x40) && l->ddram[a] != expected[a]) return (a >= ROW_4) ? "posted characters" : "main code's strings";
+    }
+    if(l->cg || l->ac != ac)            return "cursor";
+    if(l->id != id || l->sh != sh)      return "entry mode";
+    if(l->shift != shift)               return "display shift";
+    if(l->early)                        return "access while the LCD was busy";
+    return NULL;
+}
+
+
+int main(int argc, char **argv){
+    
+    long     rounds = 20000;
+    uint64_t first  = 1;
+    
+    for(int i=1 ; i < argc ; i++){
+        if     (!strcmp(argv[i], "-n") && i+1 < argc) rounds = atol(argv[++i]);
+        else if(!strcmp(argv[i], "-s") && i+1 < argc) first  = strtoull(argv[++i], NULL, 10);
+        else{
+            fprintf(stderr, "usage: %s [-n rounds] [-s first seed]\n", argv[0]);
+            return 2;
+        }
+    }
+    
+    for(long n=0 ; n < rounds ; n++){
+        const char *wrong = round_run(first + (uint64_t)n);
+        if(wrong){
+            printf("seed %llu fails(%s wrong)\n", (unsigned long long)(first + (uint64_t)n), wrong);
+            return 1;
+        }
+    }
+    printf("%ld rounds passed(LCD_QUEUE_URGENT %d): %ld characters posted, %ld refused(queue full)\n",
+           rounds, URGENT, posted, refused);
+    return 0;
+}
\ No newline at end of file
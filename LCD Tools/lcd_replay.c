@@ -0,0 +1,175 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Replays a bus trace recorded with "LCD_trace_dump" on a simulated HD44780
+ * and prints the reconstructed screen and the bus usage. Can also convert
+ * the trace into a VCD file to be viewed with GTKWave.
+ *
+ * Build: cc -std=c99 -O2 -o lcd_replay lcd_replay.c
+ * Usage: lcd_replay trace.bin [-r rows] [-c columns] [-v out.vcd]
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "hd44780.h"
+
+
+#define PAIR_GAP_NS   20000UL    //Nibbles closer than this belong to the same byte(used to find the first byte of a cut trace)
+#define EN_HIGH_NS    1000UL     //Width of the "EN" pulse in the VCD[nS]
+
+
+/* Prints the visible part of the DDRAM */
+static void print_screen(const Hd44780 *lcd, int rows, int columns){
+    
+    printf("+");
+    for(int c=0 ; c < columns ; c++) printf("-");
+    printf("+\n");
+    for(int r=0 ; r < rows ; r++){
+        printf("|");
+        for(int c=0 ; c < columns ; c++){
+            uint8_t ch = hd44780_cell(lcd, columns, r, c);
+            putchar((ch >= 0x20 && ch < 0x7F) ? ch : (ch < 8) ? ('0' + ch) : '.');
+        }
+        printf("|\n");
+    }
+    printf("+");
+    for(int c=0 ; c < columns ; c++) printf("-");
+    printf("+\n");
+}
+
+/* Writes the value changes of one event into the VCD file */
+static void vcd_event(FILE *vcd, uint64_t now, uint64_t next, uint8_t event){
+    
+    uint64_t fall = now + EN_HIGH_NS;
+    if(fall > next) fall = now + (next - now) / 2;  //Keep the pulse shorter than the gap to the next event
+    
+    fprintf(vcd, "#%llu\n", (unsigned long long)now);
+    fprintf(vcd, "%cs\n%cw\nb%d%d%d%d d\n", (event & 0x10) ? '1' : '0', (event & 0x20) ? '1' : '0',
+            (event >> 3) & 1, (event >> 2) & 1, (event >> 1) & 1, event & 1);
+    fprintf(vcd, "1e\n#%llu\n0e\n", (unsigned long long)fall);
+}
+
+
+int main(int argc, char **argv){
+    
+    const char *input  = NULL;
+    const char *output = NULL;
+    int rows    = 4;
+    int columns = 20;
+    
+    /*---------- Read the arguments ----------*/
+    for(int i=1 ; i < argc ; i++){
+        if     (!strcmp(argv[i], "-r") && i+1 < argc) rows    = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-c") && i+1 < argc) columns = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-v") && i+1 < argc) output  = argv[++i];
+        else if(argv[i][0] != '-' && !input)         input   = argv[i];
+        else{
+            fprintf(stderr, "usage: %s trace.bin [-r rows] [-c columns] [-v out.vcd]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(!input || rows < 1 || rows > 4 || columns < 1 || columns > 40){
+        fprintf(stderr, "usage: %s trace.bin [-r rows] [-c columns] [-v out.vcd]\n", argv[0]);
+        return 2;
+    }
+    
+    /*---------- Read the trace ----------*/
+    FILE *file = fopen(input, "rb");
+    if(!file){ perror(input); return 1; }
+    uint8_t header[10];
+    if(fread(header, 1, sizeof(header), file) != sizeof(header) || memcmp(header, "LCDT", 4) || header[4] != 1 || !header[5]){
+        fprintf(stderr, "%s: not a version 1 LCD trace\n", input);
+        return 1;
+    }
+    unsigned ticks_per_us = header[5];
+    unsigned lost  = header[6] | (header[7] << 8);
+    unsigned count = header[8] | (header[9] << 8);
+    uint64_t *time  = malloc(sizeof(uint64_t) * (count + 1));
+    uint8_t  *event = malloc(count + 1);
+    if(!time || !event){ fprintf(stderr, "out of memory\n"); return 1; }
+    uint64_t now    = 0;
+    uint16_t last   = 0;
+    for(unsigned i=0 ; i < count ; i++){
+        uint8_t bytes[3];
+        if(fread(bytes, 1, 3, file) != 3){
+            fprintf(stderr, "%s: trace ends after %u of %u events\n", input, i, count);
+            count = i;
+            break;
+        }
+        uint16_t ticks = (uint16_t)(bytes[0] | (bytes[1] << 8));
+        if(i) now += (uint16_t)(ticks - last) * 1000ULL / ticks_per_us;  //Timer wraps around, gaps have to be shorter than 65536 ticks
+        last     = ticks;
+        time[i]  = now;
+        event[i] = bytes[2];
+    }
+    fclose(file);
+    
+    /*---------- Replay the events on the simulated LCD ----------*/
+    Hd44780 lcd;
+    hd44780_reset(&lcd);
+    if(lost){
+        /* The start of the trace is missing, assume 4-bit mode and start from the first nibble pair */
+        lcd.four_bit = 1;
+        unsigned first = 0;
+        while(first + 1 < count && time[first+1] - time[first] >= PAIR_GAP_NS) first++;
+        for(unsigned i=0 ; i < first ; i++) event[i] |= 0x80;  //Mark as skipped
+    }
+    for(unsigned i=0 ; i < count ; i++){
+        if(event[i] & 0x80) continue;
+        hd44780_nibble(&lcd, time[i], (event[i] >> 4) & 1, (event[i] >> 5) & 1, event[i] & 0x0F);
+    }
+    
+    /*---------- Print the results ----------*/
+    uint64_t span = count ? (lcd.busy_until > time[count-1] ? lcd.busy_until : time[count-1]) - time[0] : 0;
+    print_screen(&lcd, rows, columns);
+    printf("events: %u(%u%s lost before the trace)\n", count, lost, (lost == 0xFFFF) ? " or more" : "");
+    printf("bytes: %ld commands, %ld data, %ld reads\n", lcd.commands, lcd.datas, lcd.reads);
+    printf("time: %.3f ms, LCD busy %.1f%%\n", span / 1e6, span ? 100.0 * lcd.busy_total / span : 0.0);
+    if(span) printf("rate: %.0f bytes/s\n", (lcd.commands + lcd.datas + lcd.reads) * 1e9 / span);
+    printf("accesses while the LCD was busy: %ld\n", lcd.early);
+    
+    /*---------- Write the VCD file ----------*/
+    if(output){
+        FILE *vcd = fopen(output, "w");
+        if(!vcd){ perror(output); return 1; }
+        fprintf(vcd, "$timescale 1ns $end\n$scope module lcd $end\n");
+        fprintf(vcd, "$var wire 1 s RS $end\n$var wire 1 w RW $end\n$var wire 1 e EN $end\n");
+        fprintf(vcd, "$var wire 4 d D7_D4 $end\n$upscope $end\n$enddefinitions $end\n");
+        fprintf(vcd, "#0\n0s\n0w\n0e\nb0000 d\n");
+        for(unsigned i=0 ; i < count ; i++){
+            vcd_event(vcd, time[i], (i+1 < count) ? time[i+1] : time[i] + 2*EN_HIGH_NS, event[i] & 0x3F);
+        }
+        fclose(vcd);
+    }
+    
+    free(time);
+    free(event);
+    return 0;
+}
@@ -0,0 +1,251 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+/*
+ * Prints the flash used by each function of the library, from the map file
+ * of a build. With two files(e.g. two configurations of "LCD.h", or before
+ * and after a change) prints both sizes and the difference side by side,
+ * with more files prints a column for each one(named after the file).
+ *
+ * Reads either an XC8 map file("-Wl,-Map=project.map", each function is
+ * sized up to the next symbol of its psect) or the output of
+ * "nm --print-size" for GCC based compilers.
+ *
+ * Build: cc -std=c99 -O2 -o lcd_size lcd_size.c
+ * Usage: lcd_size [-a] project.map [other.map ...]
+ *        (-a lists all the functions, not only the "LCD_" ones)
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+
+
+#define MAX_SYMBOLS 4096  //Max. symbols read from a file
+#define MAX_NAME    64    //Max. length of a symbol name
+#define MAX_FILES   12    //Max. files compared
+
+
+typedef struct{
+    char          name[MAX_NAME];
+    char          psect[MAX_NAME];  //(Empty for "nm" output)
+    unsigned long address;
+    unsigned long size;             //(0 until known)
+    int           end;              //1 for the "__end_of_" symbols of XC8
+} Symbol;
+
+typedef struct{
+    Symbol symbol[MAX_SYMBOLS];
+    int    count;
+    char   psect[MAX_SYMBOLS][MAX_NAME];  //Code psects and their ends(XC8)
+    unsigned long psect_end[MAX_SYMBOLS];
+    int    psects;
+} Map;
+
+
+/* Returns 1 if the whole string is a hexadecimal number */
+static int is_hex(const char *text){
+    
+    if(!*text) return 0;
+    for( ; *text ; text++) if(!isxdigit((unsigned char)*text)) return 0;
+    return 1;
+}
+
+/* Returns 1 if the psect holds code("text", "text12", ...) */
+static int is_code(const char *psect){
+    
+    if(strncmp(psect, "text", 4)) return 0;
+    for(psect += 4 ; *psect ; psect++) if(!isdigit((unsigned char)*psect)) return 0;
+    return 1;
+}
+
+/* Compares two symbols by psect and address(for qsort) */
+static int by_address(const void *a, const void *b){
+    
+    const Symbol *x = a, *y = b;
+    int psect = strcmp(x->psect, y->psect);
+    if(psect) return psect;
+    if(x->address != y->address) return (x->address > y->address) ? 1 : -1;
+    return y->end - x->end;  //(The end of a function comes before the next function at the same address)
+}
+
+/* Reads a map file, returns 0 if it can't be read */
+static int read_map(const char *path, Map *map){
+    
+    FILE *file = fopen(path, "r");
+    if(!file){ perror(path); return 0; }
+    
+    char line[512];
+    char token[8][MAX_NAME];
+    map->count  = 0;
+    map->psects = 0;
+    while(fgets(line, sizeof(line), file)){
+        int tokens = 0;
+        for(char *t = strtok(line, " \t\r\n") ; t && tokens < 8 ; t = strtok(NULL, " \t\r\n")){
+            snprintf(token[tokens++], MAX_NAME, "%s", t);
+        }
+        
+        /*---------- "nm --print-size": address size type name ----------*/
+        if(tokens == 4 && is_hex(token[0]) && is_hex(token[1]) && strchr("tTW", token[2][0]) && !token[2][1]){
+            if(map->count == MAX_SYMBOLS) break;
+            Symbol *s = &map->symbol[map->count++];
+            snprintf(s->name, MAX_NAME, "%s", token[3]);
+            s->psect[0] = '\0';
+            s->address  = strtoul(token[0], NULL, 16);
+            s->size     = strtoul(token[1], NULL, 16);
+            s->end      = 0;
+            continue;
+        }
+        
+        /*---------- XC8 symbol table: name psect address ----------*/
+        if(tokens == 3 && token[0][0] == '_' && is_code(token[1]) && is_hex(token[2])){
+            if(map->count == MAX_SYMBOLS) break;
+            Symbol *s = &map->symbol[map->count++];
+            int end = !strncmp(token[0], "__end_of_", 9);
+            snprintf(s->name, MAX_NAME, "%s", token[0] + (end ? 9 : 1));  //(XC8 adds '_' to the C names)
+            snprintf(s->psect, MAX_NAME, "%s", token[1]);
+            s->address = strtoul(token[2], NULL, 16);
+            s->size    = 0;
+            s->end     = end;
+            continue;
+        }
+        
+        /*---------- XC8 psect list: [module] psect link load length ... ----------*/
+        for(int i=0 ; i + 3 < tokens ; i++){
+            if(!is_code(token[i]) || !is_hex(token[i+1]) || !is_hex(token[i+2]) || !is_hex(token[i+3])) continue;
+            if(map->psects == MAX_SYMBOLS) break;
+            memcpy(map->psect[map->psects], token[i], MAX_NAME);
+            map->psect_end[map->psects++] = strtoul(token[i+1], NULL, 16) + strtoul(token[i+3], NULL, 16);
+            break;
+        }
+    }
+    fclose(file);
+    
+    /*---------- Size each XC8 function up to the next symbol(or the end of its psect) ----------*/
+    qsort(map->symbol, map->count, sizeof(Symbol), by_address);
+    for(int i=0 ; i < map->count ; i++){
+        Symbol *s = &map->symbol[i];
+        if(!s->psect[0] || s->end) continue;
+        if(i + 1 < map->count && !strcmp(map->symbol[i+1].psect, s->psect)){
+            s->size = map->symbol[i+1].address - s->address;
+            continue;
+        }
+        for(int p=0 ; p < map->psects ; p++){
+            if(!strcmp(map->psect[p], s->psect) && map->psect_end[p] > s->address) s->size = map->psect_end[p] - s->address;
+        }
+    }
+    return 1;
+}
+
+/* Returns the size of a function in a map, -1 if it isn't there */
+static long find(const Map *map, const char *name){
+    
+    for(int i=0 ; i < map->count ; i++){
+        if(!map->symbol[i].end && !strcmp(map->symbol[i].name, name)) return (long)map->symbol[i].size;
+    }
+    return -1;
+}
+
+/* Compares two names(for qsort) */
+static int by_name(const void *a, const void *b){
+    
+    return strcmp(*(const char* const*)a, *(const char* const*)b);
+}
+
+
+int main(int argc, char **argv){
+    
+    const char *path[MAX_FILES];
+    int files = 0;
+    int all   = 0;
+    
+    /*---------- Read the arguments ----------*/
+    for(int i=1 ; i < argc ; i++){
+        if     (!strcmp(argv[i], "-a"))                   all = 1;
+        else if(argv[i][0] != '-' && files < MAX_FILES) path[files++] = argv[i];
+        else                                            files = MAX_FILES + 1;
+    }
+    if(files < 1 || files > MAX_FILES){
+        fprintf(stderr, "usage: %s [-a] project.map [other.map ...](max. %d files)\n", argv[0], MAX_FILES);
+        return 2;
+    }
+    
+    static Map map[MAX_FILES];
+    for(int f=0 ; f < files ; f++){
+        if(!read_map(path[f], &map[f])) return 1;
+    }
+    
+    /*---------- Collect the names of the functions in either file ----------*/
+    static const char *name[MAX_FILES * MAX_SYMBOLS];
+    int names = 0;
+    for(int f=0 ; f < files ; f++){
+        for(int i=0 ; i < map[f].count ; i++){
+            const Symbol *s = &map[f].symbol[i];
+            if(s->end || (!all && strncmp(s->name, "LCD_", 4))) continue;
+            int known = 0;
+            for(int n=0 ; n < names && !known ; n++) known = !strcmp(name[n], s->name);
+            if(!known) name[names++] = s->name;
+        }
+    }
+    if(!names){
+        fprintf(stderr, "no functions found(is it an XC8 map file or \"nm --print-size\" output?)\n");
+        return 1;
+    }
+    qsort(name, names, sizeof(name[0]), by_name);
+    
+    /*---------- Print the table(the difference only for two files) ----------*/
+    long total[MAX_FILES] = { 0 };
+    printf("%-28s", "function");
+    if(files == 1)      printf(" %8s", "bytes");
+    else if(files == 2) printf(" %8s %8s %8s", "first", "second", "change");
+    else{
+        for(int f=0 ; f < files ; f++){
+            const char *base = strrchr(path[f], '/') ? strrchr(path[f], '/') + 1 : path[f];  //(File name without the folders and the extension)
+            printf(" %8.*s", (int)(strchr(base, '.') ? strchr(base, '.') - base : (long)strlen(base)), base);
+        }
+    }
+    printf("\n");
+    for(int n=0 ; n < names ; n++){
+        long size[MAX_FILES];
+        printf("%-28s", name[n]);
+        for(int f=0 ; f < files ; f++){
+            size[f] = find(&map[f], name[n]);
+            if(size[f] > 0) total[f] += size[f];
+            if(size[f] < 0) printf(" %8s", "-");
+            else            printf(" %8ld", size[f]);
+        }
+        if(files == 2) printf(" %+8ld", (size[1] < 0 ? 0 : size[1]) - (size[0] < 0 ? 0 : size[0]));
+        printf("\n");
+    }
+    printf("%-28s", "total");
+    for(int f=0 ; f < files ; f++) printf(" %8ld", total[f]);
+    if(files == 2) printf(" %+8ld", total[1] - total[0]);
+    printf("\n");
+    return 0;
+}
\ No newline at end of file
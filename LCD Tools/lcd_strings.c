@@ -0,0 +1,411 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Compresses the texts of a multi-language UI into string tables for
+ * "LCD_write_packed":
+ * - Substrings repeated in the texts(of all the languages together) become
+ *   tokens, a single byte(0x80 + token number, max. 128 tokens) in the text
+ * - Tokens are picked one by one, always the one saving the most program
+ *   memory(its own characters and the pointer to it included)
+ * - Characters 0x80-0xFF(and "LCD_PACKED_ESCAPE") are written with
+ *   "LCD_PACKED_ESCAPE" in front, unless a token of its own saves more
+ * - Reports the program memory saved and the characters decoded per
+ *   "LCD_write_buffer" call, the texts and the tokens are read straight
+ *   from program memory on the target, no RAM buffer is needed
+ *
+ * Build: cc -std=c99 -O2 -o lcd_strings lcd_strings.c
+ * Usage: lcd_strings texts.txt [-o texts.c] [-H texts.h]
+ *
+ * Texts file(one command per line, '#' starts a comment):
+ *   languages en de               Languages, in the order of the texts(before the texts)
+ *   text hello "Hello" "Hallo"    Text in each language, becomes "LCD_TEXT_HELLO" in the header
+ *                                 (\1-\7 are custom characters, \0 is written as 0x08, the same
+ *                                 custom character, \xHH any code)
+ *
+ * Header:
+ *   LCD_LANGUAGE_EN, LCD_TEXT_HELLO..  Numbers of the languages and the texts
+ *   LCD_texts[language][text]          Compressed texts
+ *   LCD_tokens                         Tokens used by the texts
+ *   LCD_write_packed(LCD_texts[LCD_LANGUAGE_DE][LCD_TEXT_HELLO], LCD_tokens);
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+
+
+#define LCD_PACKED_ESCAPE 0x1F  //(Same as "LCD.c")
+#define LCD_PACKED_TOKEN  0x80
+
+#define MAX_LANGUAGES 16
+#define MAX_TEXTS     1024
+#define MAX_LENGTH    255   //Characters in a text
+#define MAX_TOKENS    128
+#define MAX_TOKEN     32    //Characters in a token
+#define CANDIDATES    16    //Best guesses counted exactly before picking a token
+#define POINTER_SIZE  2     //Bytes of a pointer in program memory(PIC16/PIC18)
+
+#define TOKEN(n) (256 + (n))  //Value of a token inside a text(characters are 1-255)
+
+
+typedef struct{
+    int text, position, length;  //Where the substring is first seen
+    int count;                   //Occurrences(overlapping ones too, only a guess)
+} Entry;
+
+static int languages, texts;
+static char language_name[MAX_LANGUAGES][32];
+static char text_name[MAX_TEXTS][32];
+static int *text[MAX_TEXTS * MAX_LANGUAGES];   //Characters and tokens of each text, 0 terminated
+static int  text_length[MAX_TEXTS * MAX_LANGUAGES];
+static int  token[MAX_TOKENS][MAX_TOKEN];
+static int  token_length[MAX_TOKENS];
+static int  tokens;
+
+static Entry   *table;
+static uint32_t table_size;
+
+static int line_number;
+static const char *file_name;
+
+
+static void fail(const char *message){
+    fprintf(stderr, "%s:%d: %s\n", file_name, line_number, message);
+    exit(1);
+}
+
+/* Parses a quoted string with C-like escapes, returns the number of characters and moves "p" after it */
+static int parse_string(const char **p, int *out, int max){
+    
+    int length = 0;
+    const char *s = *p;
+    while(*s && *s != '"') s++;
+    if(*s++ != '"') fail("expected a quoted string");
+    while(*s && *s != '"'){
+        int c = (unsigned char)*s++;
+        if(c == '\\'){
+            c = (unsigned char)*s++;
+            if(c >= '0' && c <= '7') c = (c == '0') ? 0x08 : c - '0';
+            else if(c == 'x'){  //(2 digits at most, so "\xFCck" is 0xFC followed by "ck")
+                char digits[3] = {0};
+                for(int i=0 ; i < 2 && isxdigit((unsigned char)*s) ; i++) digits[i] = *s++;
+                if(!digits[0]) fail("bad \\x escape");
+                c = (int)strtol(digits, NULL, 16);
+                if(c == 0) c = 0x08;
+            }
+            else if(c != '\\' && c != '"') fail("unknown escape");
+        }
+        if(length == max) fail("text too long");
+        out[length++] = c;
+    }
+    if(*s != '"') fail("missing closing quote");
+    *p = s + 1;
+    return length;
+}
+
+/* Program memory taken by a character or a token in a text */
+static int cost_of(int value){
+    if(value >= TOKEN(0)) return 1;
+    return (value >= 0x80 || value == LCD_PACKED_ESCAPE) ? 2 : 1;
+}
+
+/* Program memory saved by turning a substring into a token */
+static long saving_of(const int *s, int length, int count){
+    int cost = 0;
+    for(int i=0 ; i < length ; i++) cost += cost_of(s[i]);
+    return (long)count * (cost - 1) - (length + 1 + POINTER_SIZE);
+}
+
+static uint32_t hash_of(const int *s, int length){
+    uint32_t hash = 2166136261u;
+    for(int i=0 ; i < length ; i++) hash = (hash ^ (uint32_t)s[i]) * 16777619u;
+    return hash;
+}
+
+/* Occurrences of a substring that can all be replaced(no overlaps, no tokens inside) */
+static int count_exact(const int *s, int length){
+    int count = 0;
+    for(int t=0 ; t < texts * languages ; t++){
+        for(int i=0 ; i + length <= text_length[t] ; ){
+            if(!memcmp(text[t] + i, s, length * sizeof(int))){ count++; i += length; }
+            else i++;
+        }
+    }
+    return count;
+}
+
+/* Picks the substring saving the most, returns 0 if none saves anything */
+static int pick_token(int *best, int *best_length){
+    
+    memset(table, 0, table_size * sizeof(Entry));
+    
+    /*---------- Count every substring made of characters only(overlapping, as a guess) ----------*/
+    for(int t=0 ; t < texts * languages ; t++){
+        const int *s = text[t];
+        for(int i=0 ; i < text_length[t] ; i++){
+            for(int length=1 ; length <= MAX_TOKEN && i + length <= text_length[t] ; length++){
+                if(s[i + length - 1] >= TOKEN(0)) break;
+                if(length == 1 && cost_of(s[i]) == 1) continue;  //(Can't save anything)
+                uint32_t slot = hash_of(s + i, length) & (table_size - 1);
+                for( ; ; slot = (slot + 1) & (table_size - 1)){
+                    Entry *e = &table[slot];
+                    if(!e->count){
+                        e->text = t; e->position = i; e->length = length; e->count = 1;
+                        break;
+                    }
+                    if(e->length == length && !memcmp(text[e->text] + e->position, s + i, length * sizeof(int))){
+                        e->count++;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    
+    /*---------- Keep the best guesses, then count them exactly ----------*/
+    Entry candidate[CANDIDATES];
+    long  guess[CANDIDATES];
+    int   candidates = 0;
+    for(uint32_t slot=0 ; slot < table_size ; slot++){
+        Entry *e = &table[slot];
+        if(!e->count) continue;
+        long saving = saving_of(text[e->text] + e->position, e->length, e->count);
+        if(saving <= 0) continue;
+        int i;
+        if(candidates < CANDIDATES) i = candidates++;
+        else if(saving > guess[CANDIDATES-1]) i = CANDIDATES - 1;
+        else continue;
+        for( ; i > 0 && guess[i-1] < saving ; i--){ candidate[i] = candidate[i-1]; guess[i] = guess[i-1]; }
+        candidate[i] = *e;
+        guess[i] = saving;
+    }
+    long best_saving = 0;
+    for(int i=0 ; i < candidates ; i++){
+        const int *s = text[candidate[i].text] + candidate[i].position;
+        long saving = saving_of(s, candidate[i].length, count_exact(s, candidate[i].length));
+        if(saving > best_saving){
+            best_saving = saving;
+            *best_length = candidate[i].length;
+            memcpy(best, s, candidate[i].length * sizeof(int));
+        }
+    }
+    return best_saving > 0;
+}
+
+/* Replaces the occurrences of a token in all the texts */
+static void apply_token(int number){
+    for(int t=0 ; t < texts * languages ; t++){
+        int *s = text[t];
+        int length = token_length[number];
+        int j = 0;
+        for(int i=0 ; i < text_length[t] ; ){
+            if(i + length <= text_length[t] && !memcmp(s + i, token[number], length * sizeof(int))){
+                s[j++] = TOKEN(number);
+                i += length;
+            }
+            else s[j++] = s[i++];
+        }
+        s[j] = 0;
+        text_length[t] = j;
+    }
+}
+
+/* Writes bytes as a C string literal */
+static void write_literal(FILE *out, const int *s, int length){
+    fputc('"', out);
+    for(int i=0 ; i < length ; i++){
+        int c = s[i];
+        if(c >= 0x20 && c < 0x7F && c != '"' && c != '\\' && c != '?') fputc(c, out);
+        else if(c == '"' || c == '\\' || c == '?')                     fprintf(out, "\\%c", c);
+        else                                                           fprintf(out, "\\%03o", c);
+    }
+    fputc('"', out);
+}
+
+/* Writes a text as a C string literal, tokens and escaped characters included */
+static void write_text(FILE *out, const int *s, int length, int *size){
+    int bytes[2 * MAX_LENGTH];
+    int count = 0;
+    for(int i=0 ; i < length ; i++){
+        if(s[i] >= TOKEN(0)) bytes[count++] = LCD_PACKED_TOKEN + s[i] - TOKEN(0);
+        else{
+            if(cost_of(s[i]) == 2) bytes[count++] = LCD_PACKED_ESCAPE;
+            bytes[count++] = s[i];
+        }
+    }
+    write_literal(out, bytes, count);
+    *size += count + 1;
+}
+
+/* Writes a name in capitals */
+static void write_upper(FILE *out, const char *name){
+    for( ; *name ; name++) fputc(toupper((unsigned char)*name), out);
+}
+
+
+int main(int argc, char **argv){
+    
+    const char *c_name = NULL, *h_name = NULL;
+    
+    /*---------- Read the arguments ----------*/
+    for(int i=1 ; i < argc ; i++){
+        if     (!strcmp(argv[i], "-o") && i+1 < argc) c_name = argv[++i];
+        else if(!strcmp(argv[i], "-H") && i+1 < argc) h_name = argv[++i];
+        else if(argv[i][0] != '-' && !file_name)     file_name = argv[i];
+        else{
+            file_name = NULL;
+            break;
+        }
+    }
+    if(!file_name){
+        fprintf(stderr, "usage: %s texts.txt [-o texts.c] [-H texts.h]\n", argv[0]);
+        return 2;
+    }
+    FILE *in = fopen(file_name, "r");
+    if(!in){ perror(file_name); return 1; }
+    
+    /*---------- Read the texts line by line ----------*/
+    char line[4096];
+    long plain = 0;  //Program memory of the texts as plain strings
+    long characters = 0;
+    while(fgets(line, sizeof(line), in)){
+        
+        char word[32] = "";
+        line_number++;
+        char *hash  = strchr(line, '#');
+        char *quote = strchr(line, '"');
+        if(hash && (!quote || hash < quote)) *hash = '\0';  //(A '#' in or after the texts is checked while reading them)
+        if(sscanf(line, "%31s", word) != 1) continue;
+        
+        if(!strcmp(word, "languages")){
+            if(languages) fail("languages are already given");
+            for(char *p = strtok(strstr(line, word) + strlen(word), " \t\r\n") ; p ; p = strtok(NULL, " \t\r\n")){
+                if(languages == MAX_LANGUAGES) fail("too many languages");
+                if(strlen(p) > 31) fail("language name too long");
+                for(char *n = p ; *n ; n++) if(!isalnum((unsigned char)*n) && *n != '_') fail("language names are C identifiers");
+                strcpy(language_name[languages++], p);
+            }
+            if(!languages) fail("languages needs at least one name");
+        }
+        else if(!strcmp(word, "text")){
+            if(!languages) fail("expected \"languages\"");
+            if(texts == MAX_TEXTS) fail("too many texts");
+            if(sscanf(line, "%*s %31s", text_name[texts]) != 1 || text_name[texts][0] == '"') fail("text needs a name");
+            for(char *n = text_name[texts] ; *n ; n++) if(!isalnum((unsigned char)*n) && *n != '_') fail("text names are C identifiers");
+            const char *p = strstr(line, text_name[texts]) + strlen(text_name[texts]);
+            for(int l=0 ; l < languages ; l++){
+                int t = texts * languages + l;
+                text[t] = malloc((MAX_LENGTH + 1) * sizeof(int));
+                if(!text[t]){ fprintf(stderr, "out of memory\n"); return 1; }
+                text_length[t] = parse_string(&p, text[t], MAX_LENGTH);
+                text[t][text_length[t]] = 0;
+                plain += text_length[t] + 1;
+                characters += text_length[t];
+            }
+            while(isspace((unsigned char)*p)) p++;
+            if(*p && *p != '#') fail("more texts than languages");
+            texts++;
+        }
+        else{
+            fail("unknown command");
+        }
+    }
+    fclose(in);
+    if(!texts) fail("no texts");
+    
+    /*---------- Pick the tokens ----------*/
+    table_size = 1;
+    while(table_size < 2u * (uint32_t)characters * MAX_TOKEN) table_size <<= 1;
+    table = malloc(table_size * sizeof(Entry));
+    if(!table){ fprintf(stderr, "out of memory\n"); return 1; }
+    while(tokens < MAX_TOKENS && pick_token(token[tokens], &token_length[tokens])){
+        apply_token(tokens);
+        tokens++;
+    }
+    free(table);
+    
+    /*---------- Write the tables ----------*/
+    FILE *out = c_name ? fopen(c_name, "w") : stdout;
+    FILE *header = h_name ? fopen(h_name, "w") : NULL;
+    if(!out || (h_name && !header)){ perror(c_name && !out ? c_name : h_name); return 1; }
+    
+    fprintf(out, "/* Generated by lcd_strings from \"%s\", don't edit */\n\n#include \"LCD.h\"\n\n", file_name);
+    int token_size = 0;
+    fprintf(out, "const char * const LCD_tokens[] = {\n");
+    for(int n=0 ; n < tokens ; n++){
+        fprintf(out, "    ");
+        write_literal(out, token[n], token_length[n]);
+        fprintf(out, (n + 1 < tokens) ? ",\n" : "\n");
+        token_size += token_length[n] + 1 + POINTER_SIZE;
+    }
+    if(!tokens) fprintf(out, "    \"\"\n");
+    fprintf(out, "};\n\n");
+    
+    int packed = 0;
+    long segments = 0;  //"LCD_write_buffer" calls made by "LCD_write_packed"
+    for(int l=0 ; l < languages ; l++){
+        fprintf(out, "static const char * const LCD_texts_%s[] = {\n", language_name[l]);
+        for(int i=0 ; i < texts ; i++){
+            int t = i * languages + l;
+            fprintf(out, "    ");
+            write_text(out, text[t], text_length[t], &packed);
+            fprintf(out, (i + 1 < texts) ? ",  /* %s */\n" : "   /* %s */\n", text_name[i]);
+            for(int j=0 ; j < text_length[t] ; j++){
+                if(j == 0 || text[t][j] >= TOKEN(0) || cost_of(text[t][j]) == 2 || text[t][j-1] >= TOKEN(0) || cost_of(text[t][j-1]) == 2) segments++;
+            }
+        }
+        fprintf(out, "};\n\n");
+    }
+    fprintf(out, "const char * const * const LCD_texts[] = {\n");
+    for(int l=0 ; l < languages ; l++) fprintf(out, (l + 1 < languages) ? "    LCD_texts_%s,\n" : "    LCD_texts_%s\n", language_name[l]);
+    fprintf(out, "};\n");
+    
+    if(header){
+        fprintf(header, "/* Generated by lcd_strings from \"%s\", don't edit */\n\n", file_name);
+        for(int l=0 ; l < languages ; l++){ fprintf(header, "#define LCD_LANGUAGE_"); write_upper(header, language_name[l]); fprintf(header, " %d\n", l); }
+        fprintf(header, "#define LCD_LANGUAGE_COUNT %d\n\n", languages);
+        for(int i=0 ; i < texts ; i++){ fprintf(header, "#define LCD_TEXT_"); write_upper(header, text_name[i]); fprintf(header, " %d\n", i); }
+        fprintf(header, "#define LCD_TEXT_COUNT %d\n\n", texts);
+        fprintf(header, "extern const char * const LCD_tokens[];\n");
+        fprintf(header, "extern const char * const * const LCD_texts[];\n");
+    }
+    
+    /*---------- Report ----------*/
+    long total = packed + token_size;
+    fprintf(stderr, "%d texts in %d languages, %ld characters\n", texts, languages, characters);
+    fprintf(stderr, "plain: %ld bytes\n", plain);
+    fprintf(stderr, "packed: %ld bytes(%d texts + %d tokens, pointer tables of the texts not counted in either)\n",
+            total, packed, token_size);
+    fprintf(stderr, "saved: %ld bytes(%.1f%%)\n", plain - total, plain ? 100.0 * (plain - total) / plain : 0.0);
+    fprintf(stderr, "decode: %.2f characters per \"LCD_write_buffer\" call(%.2f for \"LCD_write_string\")\n",
+            segments ? (double)characters / segments : 0.0, (double)characters / (texts * languages));
+    if(c_name) fclose(out);
+    if(header) fclose(header);
+    return 0;
+}
@@ -0,0 +1,156 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Compares the two ways of sending the characters of a string on the
+ * simulated LCD:
+ * - "per character":    "LCD_write_data" for each character, the way
+ *                       "LCD_write_string" did it before "LCD_write_buffer"
+ *                       (data mode entered again and a call for each one)
+ * - "LCD_write_buffer": "LCD_write_string" as it is now(data mode entered
+ *                       once, the characters sent in one loop)
+ * For strings of a few lengths it prints the CPU time of the PC and the
+ * cycles(time stamp counter of x86 PCs) per character, and the bus time
+ * of the LCD per character. The LCD is checked to show the same for both.
+ *
+ * The simulated LCD takes the same CPU time in both, so the difference of
+ * the two is what the library itself saves per character.
+ *
+ * Build: cc -std=c99 -O2 -I . -I "../LCD Single File/LCD/Header Files"
+ *           -I "../LCD Single File/LCD/Source Files" -o write_bench write_bench.c
+ * Usage: write_bench [-n characters]
+ */
+
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES() __rdtsc()
+#else
+#define CYCLES() 0ULL  //(No cycle counter, only the time is printed)
+#endif
+
+#include "LCD.h"
+#include "LCD.c"
+
+
+#define ROUNDS 11  //Rounds of the CPU time measurement
+
+static const char text[] = "Temperature: 23.5 C ";  //(20 characters, shorter lengths use the start of it)
+static const uint8_t lengths[] = { 1, 4, 20 };
+
+
+/* The old "LCD_write_string"(not inlined, like the library function) */
+__attribute__((noinline)) static void write_per_character(const char *string){
+    for(uint8_t i=0 ; string[i] != '\0' ; i++){
+        LCD_write_data(string[i]);
+    }
+}
+
+__attribute__((noinline)) static void write_buffer(const char *string){
+    LCD_write_string(string);
+}
+
+
+typedef struct{
+    const char *name;
+    void      (*write)(const char*);
+    double      cpu_ns;      //Time of the PC per character[nS]
+    double      cycles;      //Cycles of the PC per character
+    double      bus_us;      //Simulated time per character[uS]
+    uint8_t     ddram[0x80];
+} Way;
+
+
+int main(int argc, char **argv){
+    
+    long characters = 1000000;
+    
+    for(int i=1 ; i < argc ; i++){
+        if(!strcmp(argv[i], "-n") && i+1 < argc) characters = atol(argv[++i]);
+        else{
+            fprintf(stderr, "usage: %s [-n characters]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(characters < 20) characters = 20;
+    
+    int same = 1;
+    printf("%-8s %-18s %14s %14s %14s\n", "length", "way", "cpu[nS/char]", "cycles/char", "bus[uS/char]");
+    
+    for(size_t l=0 ; l < sizeof(lengths) ; l++){
+        
+        char string[sizeof(text)];
+        memcpy(string, text, lengths[l]);
+        string[lengths[l]] = '\0';
+        long strings = characters / lengths[l];
+        
+        Way way[2] = {
+            { "per character",    write_per_character, 0, 0, 0, {0} },
+            { "LCD_write_buffer", write_buffer,        0, 0, 0, {0} }
+        };
+        
+        /*---------- Write once to get the bus time and what the LCD shows ----------*/
+        for(int w=0 ; w < 2 ; w++){
+            host_reset();
+            LCD_init();
+            uint64_t from = host_now;
+            way[w].write(string);
+            way[w].bus_us = (host_now - from) / 1000.0 / lengths[l];
+            memcpy(way[w].ddram, host_lcd.ddram, sizeof(way[w].ddram));
+        }
+        same &= !memcmp(way[0].ddram, way[1].ddram, sizeof(way[0].ddram));
+        
+        /*---------- Write many times to measure the CPU time(best of a few rounds, ways taking turns) ----------*/
+        for(int round=0 ; round < ROUNDS ; round++){
+            for(int w=0 ; w < 2 ; w++){
+                struct timespec start, end;
+                clock_gettime(CLOCK_MONOTONIC, &start);
+                unsigned long long first = CYCLES();
+                for(long i=0 ; i < strings ; i++){
+                    way[w].write(string);
+                }
+                unsigned long long last = CYCLES();
+                clock_gettime(CLOCK_MONOTONIC, &end);
+                double cpu_ns = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / ((double)strings * lengths[l]);
+                double cycles = (double)(last - first) / ((double)strings * lengths[l]);
+                if(!round || cpu_ns < way[w].cpu_ns) way[w].cpu_ns = cpu_ns;
+                if(!round || cycles < way[w].cycles) way[w].cycles = cycles;
+            }
+        }
+        
+        /*---------- Print the results ----------*/
+        for(int w=0 ; w < 2 ; w++){
+            printf("%-8u %-18s %14.1f %14.1f %14.1f\n", lengths[l], way[w].name, way[w].cpu_ns, way[w].cycles, way[w].bus_us);
+        }
+    }
+    printf("LCD shows %s\n", same ? "the same" : "DIFFERENT");
+    return same ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2022 Ahmet Burak Irmak (https://youtube.com/Microesque)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Stand-in for XC8's <xc.h>, for the programs in "LCD Tools" that run the
+ * library itself on the PC. The port A pins(the ones in the default "LCD.h")
+ * are connected to the simulated HD44780 of "hd44780.h", "__delay_us",
+ * "__delay_ms" and "TMR1"(1 tick per uS) move the simulated time forward.
+ *
+ * The program includes the library's "LCD.c" after this file is found as
+ * <xc.h>(cc -I "LCD Tools" ...), so everything is one translation unit:
+ *   #include "LCD.h"        (the configuration can be changed after this
+ *   #undef  LCD_USE_RW       with #undef/#define, nothing in "LCD.h" uses it)
+ *   #define LCD_USE_RW 1
+ *   #include "LCD.c"
+ *
+ * "EN" pulses are taken when the library waits for the pulse width, the
+ * interrupt set in "host_interrupt" is called when the time passes
+ * "host_interrupt_at"(only between the bus accesses, like an interrupt
+ * that doesn't touch the LCD itself).
+ */
+
+
+#ifndef XC_H
+#define	XC_H
+
+#include <stdint.h>
+
+#include "hd44780.h"
+
+
+typedef struct{ unsigned LATA0:1, LATA1:1, LATA2:1, LATA3:1, LATA4:1, LATA5:1, LATA6:1, LATA7:1; } LATAbits_t;
+typedef struct{ unsigned TRISA0:1, TRISA1:1, TRISA2:1, TRISA3:1, TRISA4:1, TRISA5:1, TRISA6:1, TRISA7:1; } TRISAbits_t;
+typedef struct{ unsigned RA0:1, RA1:1, RA2:1, RA3:1, RA4:1, RA5:1, RA6:1, RA7:1; } PORTAbits_t;
+
+static LATAbits_t  LATAbits;
+static TRISAbits_t TRISAbits;
+static PORTAbits_t PORTAbits;
+
+static Hd44780  host_lcd;                  //The LCD on port A(RS: RA0, EN: RA1, D4-D7: RA2-RA5, R/W: RA6)
+static uint64_t host_now;                  //Simulated time[nS]
+static void   (*host_interrupt)(void);     //Called once when the time passes "host_interrupt_at"(NULL if none)
+static uint64_t host_interrupt_at;         //[nS]
+
+
+/* Moves the time forward, calling the interrupt when its time comes */
+static inline void host_wait(uint64_t ns){
+    host_now += ns;
+    if(host_interrupt && host_now >= host_interrupt_at){
+        void (*interrupt)(void) = host_interrupt;
+        host_interrupt = NULL;             //(The interrupt may set itself again)
+        interrupt();
+    }
+}
+
+/* Gives an "EN" pulse to the LCD if "EN" is high, drives D4-D7 if it's a read */
+static inline void host_bus(void){
+    if(!LATAbits.LATA1) return;
+    LATAbits.LATA1 = 0;                    //(Taken once, the library clears "EN" after the pulse width anyway)
+    uint8_t nibble = (uint8_t)((LATAbits.LATA5 << 3) | (LATAbits.LATA4 << 2) | (LATAbits.LATA3 << 1) | LATAbits.LATA2);
+    nibble = hd44780_nibble(&host_lcd, host_now, LATAbits.LATA0, LATAbits.LATA6, nibble);
+    if(LATAbits.LATA6){
+        PORTAbits.RA5 = (nibble >> 3) & 1; PORTAbits.RA4 = (nibble >> 2) & 1;
+        PORTAbits.RA3 = (nibble >> 1) & 1; PORTAbits.RA2 = nibble & 1;
+    }
+}
+
+/* Reads the free-running timer(reading it takes 1 uS) */
+static inline uint16_t host_timer(unsigned ticks_per_us){
+    host_wait(1000);
+    return (uint16_t)(host_now * ticks_per_us / 1000);
+}
+
+/* Starts from a powered-up LCD at time 0 */
+static inline void host_reset(void){
+    hd44780_reset(&host_lcd);
+    host_now = 0;
+    host_interrupt = NULL;
+}
+
+#define __delay_us(x) (host_bus(), host_wait((uint64_t)(x) * 1000))
+#define __delay_ms(x) (host_bus(), host_wait((uint64_t)(x) * 1000000))
+#define TMR1          host_timer(LCD_TIMER_TICKS_PER_US)
+
+#endif	/* XC_H */